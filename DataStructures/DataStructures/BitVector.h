@@ -0,0 +1,246 @@
+#ifndef BIT_VECTOR_H
+#define BIT_VECTOR_H
+
+#include <algorithm>
+#include <cstdint>
+#include <initializer_list>
+#include "Vector.h"
+#include "Intrinsics.h"
+
+// vector of bits packed 64 to a word, with popcount based rank and select.
+// rank, select and count only read, so any number of threads may call them at once
+// as long as nothing writes. push_back keeps their directory of block ranks up to date,
+// but after set they scan from the last up to date block until build_rank is called
+class BitVector {
+public:
+	typedef std::size_t size_type;
+	typedef bool value_type;
+
+	// proxy returned by the non-const index operator
+	class reference {
+	private:
+		BitVector *m_vec;
+		size_type m_index;
+
+	public:
+		reference(BitVector *vec, const size_type& index) : m_vec(vec), m_index(index) {}
+
+		operator bool() const { return static_cast<const BitVector&>(*m_vec)[m_index]; }
+		reference& operator=(bool bit) { m_vec->set(m_index, bit); return *this; }
+		reference& operator=(const reference& rhs) { return *this = bool(rhs); }
+		};
+
+	class const_iterator {
+	private:
+		const BitVector *m_vec;
+		size_type m_index;
+
+	public:
+		const_iterator(const BitVector *vec = nullptr, const size_type& index = 0) : m_vec(vec), m_index(index) {}
+
+		bool operator*() const { return (*m_vec)[m_index]; }
+
+		const_iterator& operator++() { ++m_index; return *this; }
+		const_iterator operator++(int) { const_iterator tmp = *this; ++m_index; return tmp; }
+
+		bool operator==(const const_iterator& rhs) const { return m_index == rhs.m_index; }
+		bool operator!=(const const_iterator& rhs) const { return m_index != rhs.m_index; }
+		};
+
+private:
+	static const size_type wordBits = 64;
+	// words covered by one entry of the rank directory
+	static const size_type blockWords = 8;
+
+	Vector<std::uint64_t> m_words;
+	size_type m_size;
+
+	// m_blockRanks[b] is the number of set bits before block b, with the total as the last entry
+	Vector<size_type> m_blockRanks;
+	// number of leading entries of m_blockRanks that are up to date
+	size_type m_validRanks;
+
+	size_type blockCount() const;
+	bool ranksCurrent() const;
+	void invalidateRanks(const size_type& index);
+
+public:
+	//constructors
+	BitVector();
+	explicit BitVector(const size_type& n, bool bit = false);
+	BitVector(std::initializer_list<bool> ls);
+
+	// overloaded operators
+	reference operator[](const size_type& index);
+	bool operator[](const size_type& index) const;
+
+	// member functions
+	bool empty() const;
+	size_type size() const;
+
+	const_iterator begin() const;
+	const_iterator end() const;
+
+	void push_back(bool bit);
+	void set(const size_type& index, bool bit);
+
+	// bring the rank directory up to date after set, rescanning from the first block that set changed
+	void build_rank();
+
+	// number of set bits
+	size_type count() const;
+	// number of set bits before index
+	size_type rank(const size_type& index) const;
+	// index of the set bit that has n set bits before it, or size() if there is none
+	size_type select(size_type n) const;
+
+	// bytes of heap memory held, including unused capacity
+	size_type memory_bytes() const;
+	};
+
+// private functions
+
+inline BitVector::size_type BitVector::blockCount() const {
+	return (m_words.size() + blockWords - 1) / blockWords;
+	}
+
+inline bool BitVector::ranksCurrent() const {
+	return m_validRanks == blockCount() + 1;
+	}
+
+inline void BitVector::invalidateRanks(const size_type& index) {
+	m_validRanks = std::min(m_validRanks, index / (wordBits * blockWords) + 1);
+	}
+
+// constructors
+
+inline BitVector::BitVector() : m_size(0), m_blockRanks(size_type(1), size_type(0)), m_validRanks(1) {}
+
+inline BitVector::BitVector(const size_type& n, bool bit) : m_words((n + wordBits - 1) / wordBits, bit ? ~std::uint64_t(0) : 0), m_size(n), m_blockRanks(size_type(1), size_type(0)), m_validRanks(1) {
+	// keep the bits past the end cleared so that they never count towards rank
+	if (bit && n % wordBits)
+		m_words[m_words.size() - 1] >>= wordBits - n % wordBits;
+	build_rank();
+	}
+
+inline BitVector::BitVector(std::initializer_list<bool> ls) : m_size(0), m_blockRanks(size_type(1), size_type(0)), m_validRanks(1) {
+	for (bool bit : ls)
+		push_back(bit);
+	}
+
+// overloaded operators
+
+inline BitVector::reference BitVector::operator[](const size_type& index) {
+	return reference(this, index);
+	}
+
+inline bool BitVector::operator[](const size_type& index) const {
+	return (m_words[index / wordBits] >> (index % wordBits)) & 1;
+	}
+
+// member functions
+
+inline bool BitVector::empty() const {
+	return m_size == 0;
+	}
+
+inline BitVector::size_type BitVector::size() const {
+	return m_size;
+	}
+
+inline BitVector::const_iterator BitVector::begin() const {
+	return const_iterator(this, 0);
+	}
+
+inline BitVector::const_iterator BitVector::end() const {
+	return const_iterator(this, m_size);
+	}
+
+inline void BitVector::push_back(bool bit) {
+	const bool current = ranksCurrent();
+	if (m_size % wordBits == 0) {
+		m_words.push_back(0);
+		// a new block starts with every set bit so far before it
+		if (current && m_words.size() % blockWords == 1) {
+			// copied first, as push_back may reallocate the storage the reference points into
+			const size_type ones = m_blockRanks[m_blockRanks.size() - 1];
+			m_blockRanks.push_back(ones);
+			++m_validRanks;
+			}
+		}
+
+	++m_size;
+	if (bit) {
+		m_words[(m_size - 1) / wordBits] |= std::uint64_t(1) << ((m_size - 1) % wordBits);
+		// only the total changes when appending
+		if (current)
+			++m_blockRanks[m_blockRanks.size() - 1];
+		else
+			invalidateRanks(m_size - 1);
+		}
+	}
+
+inline void BitVector::set(const size_type& index, bool bit) {
+	const std::uint64_t mask = std::uint64_t(1) << (index % wordBits);
+	std::uint64_t& word = m_words[index / wordBits];
+	if (bool(word & mask) != bit) {
+		word ^= mask;
+		invalidateRanks(index);
+		}
+	}
+
+inline void BitVector::build_rank() {
+	const size_type blocks = blockCount();
+	while (m_blockRanks.size() < blocks + 1)
+		m_blockRanks.push_back(0);
+
+	for (size_type block = m_validRanks; block <= blocks; ++block) {
+		size_type ones = m_blockRanks[block - 1];
+		const size_type wordEnd = std::min(block * blockWords, m_words.size());
+		for (size_type word = (block - 1) * blockWords; word < wordEnd; ++word)
+			ones += popCount(m_words[word]);
+		m_blockRanks[block] = ones;
+		}
+	m_validRanks = blocks + 1;
+	}
+
+inline BitVector::size_type BitVector::count() const {
+	return rank(m_size);
+	}
+
+inline BitVector::size_type BitVector::rank(const size_type& index) const {
+	const size_type wordIndex = index / wordBits;
+	// start from the block's entry, or from the last entry that is up to date
+	const size_type block = std::min(wordIndex / blockWords, m_validRanks - 1);
+
+	size_type ones = m_blockRanks[block];
+	for (size_type word = block * blockWords; word != wordIndex; ++word)
+		ones += popCount(m_words[word]);
+	if (index % wordBits)
+		ones += popCount(m_words[wordIndex] & ((std::uint64_t(1) << (index % wordBits)) - 1));
+	return ones;
+	}
+
+inline BitVector::size_type BitVector::select(size_type n) const {
+	if (n >= count())
+		return m_size;
+
+	// last up to date block with fewer than n + 1 set bits before it. the words after it
+	// are scanned one at a time, past the end of the block if the directory is stale
+	const size_type block = std::upper_bound(m_blockRanks.begin(), m_blockRanks.begin() + m_validRanks, n) - m_blockRanks.begin() - 1;
+	n -= m_blockRanks[block];
+
+	size_type word = block * blockWords;
+	for (size_type ones = popCount(m_words[word]); ones <= n; ones = popCount(m_words[word])) {
+		n -= ones;
+		++word;
+		}
+	return word * wordBits + selectInWord(m_words[word], unsigned(n));
+	}
+
+inline BitVector::size_type BitVector::memory_bytes() const {
+	return (m_words.size() + m_words.reserved()) * sizeof(std::uint64_t)
+		+ (m_blockRanks.size() + m_blockRanks.reserved()) * sizeof(size_type);
+	}
+
+#endif // !BIT_VECTOR_H
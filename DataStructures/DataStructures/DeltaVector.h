@@ -0,0 +1,232 @@
+#ifndef DELTA_VECTOR_H
+#define DELTA_VECTOR_H
+
+#include <algorithm>
+#include <cstdint>
+#include <initializer_list>
+#include <emmintrin.h>
+#include "Vector.h"
+
+// compressed vector of non-decreasing 32 bit integers. every full block of 128 values is stored as
+// the distance of each value from the value four places before it, bit packed at the width of the
+// largest distance in the block, with the four lanes interleaved so that sse2 can decode four at a time
+class DeltaVector {
+public:
+	typedef std::size_t size_type;
+	typedef std::uint32_t value_type;
+
+	static const size_type blockSize = 128;
+
+	// decodes one block at a time while walking the values
+	class const_iterator {
+	private:
+		const DeltaVector *m_vec;
+		size_type m_index;
+		value_type m_block[blockSize];
+
+		void load();
+
+	public:
+		const_iterator(const DeltaVector *vec = nullptr, const size_type& index = 0);
+
+		value_type operator*() const { return m_block[m_index % blockSize]; }
+
+		const_iterator& operator++();
+		const_iterator operator++(int) { const_iterator tmp = *this; ++*this; return tmp; }
+
+		bool operator==(const const_iterator& rhs) const { return m_index == rhs.m_index; }
+		bool operator!=(const const_iterator& rhs) const { return m_index != rhs.m_index; }
+		};
+
+private:
+	static const unsigned lanes = 4;
+	static const unsigned rows = blockSize / lanes;
+
+	struct Block {
+		value_type base;
+		unsigned width;
+		// position of the block's first packed word in m_packed
+		size_type offset;
+		};
+
+	Vector<Block> m_blocks;
+	Vector<std::uint32_t> m_packed;
+	// the last size() % blockSize values, kept uncompressed until their block is full
+	value_type m_tail[blockSize];
+	size_type m_size;
+
+	void compressTail();
+	void decodeBlock(const size_type& block, unsigned rowCount, value_type *out) const;
+
+public:
+	//constructors
+	DeltaVector();
+	DeltaVector(std::initializer_list<value_type> ls);
+
+	// overloaded operators
+	value_type operator[](const size_type& index) const;
+
+	// member functions
+	bool empty() const;
+	size_type size() const;
+
+	const_iterator begin() const;
+	const_iterator end() const;
+
+	// value must not be smaller than the last value pushed
+	void push_back(const value_type& value);
+
+	// decodes the block of values starting at block * blockSize into out
+	void decode(const size_type& block, value_type *out) const;
+
+	// release the memory reserved for future blocks
+	void shrink_to_fit();
+
+	// bytes of heap memory held, including unused capacity
+	size_type memory_bytes() const;
+	};
+
+// iterator
+
+inline DeltaVector::const_iterator::const_iterator(const DeltaVector *vec, const size_type& index) : m_vec(vec), m_index(index) {
+	if (m_vec && m_index < m_vec->size())
+		load();
+	}
+
+inline void DeltaVector::const_iterator::load() {
+	m_vec->decode(m_index / blockSize, m_block);
+	}
+
+inline DeltaVector::const_iterator& DeltaVector::const_iterator::operator++() {
+	if (++m_index % blockSize == 0 && m_index < m_vec->size())
+		load();
+	return *this;
+	}
+
+// private functions
+
+inline void DeltaVector::compressTail() {
+	// distances from the value four places before, or from the block's first value for the first row
+	value_type deltas[blockSize];
+	value_type maxDelta = 0;
+	for (unsigned index = 0; index != blockSize; ++index) {
+		deltas[index] = m_tail[index] - (index < lanes ? m_tail[0] : m_tail[index - lanes]);
+		maxDelta = std::max(maxDelta, deltas[index]);
+		}
+
+	unsigned width = 0;
+	while (width < 32 && (maxDelta >> width))
+		++width;
+
+	const Block block = { m_tail[0], width, m_packed.size() };
+	m_blocks.push_back(block);
+
+	// each lane is a stream of width words, with word w of every lane stored together
+	const size_type offset = m_packed.size();
+	for (unsigned word = 0; word != lanes * width; ++word)
+		m_packed.push_back(0);
+
+	std::uint32_t *out = m_packed.begin() + offset;
+	for (unsigned lane = 0; width != 0 && lane != lanes; ++lane) {
+		unsigned bitPos = 0;
+		for (unsigned row = 0; row != rows; ++row, bitPos += width) {
+			const value_type delta = deltas[row * lanes + lane];
+			const unsigned word = bitPos / 32;
+			const unsigned shift = bitPos % 32;
+			out[word * lanes + lane] |= delta << shift;
+			if (shift + width > 32)
+				out[(word + 1) * lanes + lane] |= delta >> (32 - shift);
+			}
+		}
+	}
+
+inline void DeltaVector::decodeBlock(const size_type& block, unsigned rowCount, value_type *out) const {
+	const Block& header = m_blocks[block];
+	const __m128i *in = reinterpret_cast<const __m128i*>(m_packed.begin() + header.offset);
+	const __m128i mask = _mm_set1_epi32(header.width == 32 ? -1 : int((1u << header.width) - 1));
+
+	// running prefix sum of each lane
+	__m128i values = _mm_set1_epi32(int(header.base));
+	__m128i word = header.width ? _mm_loadu_si128(in++) : _mm_setzero_si128();
+	unsigned shift = 0;
+
+	for (unsigned row = 0; row != rowCount; ++row) {
+		__m128i delta = _mm_srl_epi32(word, _mm_cvtsi32_si128(int(shift)));
+		shift += header.width;
+		if (shift >= 32) {
+			shift -= 32;
+			if (row + 1 != rows)
+				word = _mm_loadu_si128(in++);
+			// bits of the delta that continue in the next word
+			if (shift)
+				delta = _mm_or_si128(delta, _mm_sll_epi32(word, _mm_cvtsi32_si128(int(header.width - shift))));
+			}
+		values = _mm_add_epi32(values, _mm_and_si128(delta, mask));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(out + row * lanes), values);
+		}
+	}
+
+// constructors
+
+inline DeltaVector::DeltaVector() : m_size(0) {}
+
+inline DeltaVector::DeltaVector(std::initializer_list<value_type> ls) : m_size(0) {
+	for (const value_type& value : ls)
+		push_back(value);
+	}
+
+// overloaded operators
+
+inline DeltaVector::value_type DeltaVector::operator[](const size_type& index) const {
+	const size_type block = index / blockSize;
+	if (block == m_blocks.size())
+		return m_tail[index % blockSize];
+
+	// only the rows up to the one holding index need decoding
+	value_type values[blockSize];
+	decodeBlock(block, unsigned(index % blockSize / lanes + 1), values);
+	return values[index % blockSize];
+	}
+
+// member functions
+
+inline bool DeltaVector::empty() const {
+	return m_size == 0;
+	}
+
+inline DeltaVector::size_type DeltaVector::size() const {
+	return m_size;
+	}
+
+inline DeltaVector::const_iterator DeltaVector::begin() const {
+	return const_iterator(this, 0);
+	}
+
+inline DeltaVector::const_iterator DeltaVector::end() const {
+	return const_iterator(this, m_size);
+	}
+
+inline void DeltaVector::push_back(const value_type& value) {
+	m_tail[m_size++ % blockSize] = value;
+	if (m_size % blockSize == 0)
+		compressTail();
+	}
+
+inline void DeltaVector::decode(const size_type& block, value_type *out) const {
+	if (block == m_blocks.size())
+		std::copy(m_tail, m_tail + m_size % blockSize, out);
+	else
+		decodeBlock(block, rows, out);
+	}
+
+inline void DeltaVector::shrink_to_fit() {
+	m_blocks.shrink_to_fit();
+	m_packed.shrink_to_fit();
+	}
+
+inline DeltaVector::size_type DeltaVector::memory_bytes() const {
+	return (m_blocks.size() + m_blocks.reserved()) * sizeof(Block)
+		+ (m_packed.size() + m_packed.reserved()) * sizeof(std::uint32_t);
+	}
+
+#endif // !DELTA_VECTOR_H
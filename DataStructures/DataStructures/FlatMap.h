@@ -0,0 +1,162 @@
+#ifndef FLAT_MAP_H
+#define FLAT_MAP_H
+
+#include <algorithm>
+#include <functional>
+#include <initializer_list>
+#include <utility>
+#include "Vector.h"
+#include "FlatSet.h"
+
+template<class Key, class Value, class Compare = std::less<Key>> class FlatMap {
+public:
+	typedef std::size_t size_type;
+	typedef Key key_type;
+	typedef Value mapped_type;
+	typedef std::pair<Key, Value> value_type;
+
+	// walks the entries in ascending key order regardless of the layout
+	class const_iterator {
+	private:
+		typename FlatSet<Key, Compare>::const_iterator m_keyIter;
+		const Vector<Value> *m_values;
+
+	public:
+		const_iterator(const typename FlatSet<Key, Compare>::const_iterator& keyIter, const Vector<Value> *values) : m_keyIter(keyIter), m_values(values) {}
+
+		const Key& key() const { return *m_keyIter; }
+		const Value& value() const { return (*m_values)[m_keyIter.slot()]; }
+		std::pair<const Key&, const Value&> operator*() const { return std::pair<const Key&, const Value&>(key(), value()); }
+
+		const_iterator& operator++() { ++m_keyIter; return *this; }
+		const_iterator operator++(int) { const_iterator tmp = *this; ++*this; return tmp; }
+
+		bool operator==(const const_iterator& rhs) const { return m_keyIter == rhs.m_keyIter; }
+		bool operator!=(const const_iterator& rhs) const { return m_keyIter != rhs.m_keyIter; }
+		};
+
+private:
+	FlatSet<Key, Compare> m_keys;
+	// m_values[slot] belongs to the key stored in that slot of m_keys
+	Vector<Value> m_values;
+	Compare m_comp;
+
+	void build(Vector<value_type> elems);
+
+public:
+	// constructors
+	explicit FlatMap(SearchLayout layout = SearchLayout::Sorted);
+	FlatMap(const Vector<value_type>& elems, SearchLayout layout = SearchLayout::Sorted);
+	FlatMap(std::initializer_list<value_type> ls, SearchLayout layout = SearchLayout::Sorted);
+
+	// replace the contents with elems sorted by key, keeping the first entry of duplicate keys
+	void assign(const Vector<value_type>& elems);
+
+	// member functions
+	bool empty() const;
+	size_type size() const;
+	SearchLayout layout() const;
+
+	const_iterator begin() const;
+	const_iterator end() const;
+
+	bool contains(const Key& key) const;
+
+	// value stored for key, or nullptr if the key is not in the map
+	Value* find(const Key& key);
+	const Value* find(const Key& key) const;
+	// batched find: writes the value pointer of every key in [first, last) to values
+	void find_batch(const Key *first, const Key *last, const Value **values) const;
+
+	const FlatSet<Key, Compare>& keys() const;
+	};
+
+// private functions
+
+template<class Key, class Value, class Compare> void FlatMap<Key, Value, Compare>::build(Vector<value_type> elems) {
+	std::stable_sort(elems.begin(), elems.end(),
+		[this](const value_type& lhs, const value_type& rhs) { return m_comp(lhs.first, rhs.first); });
+
+	Vector<Key> sortedKeys;
+	Vector<Value> sortedValues;
+	for (const value_type& elem : elems) {
+		if (!sortedKeys.empty() && !m_comp(sortedKeys[sortedKeys.size() - 1], elem.first))
+			continue;
+		sortedKeys.push_back(elem.first);
+		sortedValues.push_back(elem.second);
+		}
+
+	m_keys.buildSorted(sortedKeys);
+
+	// move each value to the slot its key ended up in
+	m_values = sortedValues;
+	size_type rank = 0;
+	for (typename FlatSet<Key, Compare>::const_iterator iter = m_keys.begin(); iter != m_keys.end(); ++iter)
+		m_values[iter.slot()] = sortedValues[rank++];
+	}
+
+// constructors
+
+template<class Key, class Value, class Compare> FlatMap<Key, Value, Compare>::FlatMap(SearchLayout layout) : m_keys(layout) {}
+
+template<class Key, class Value, class Compare> FlatMap<Key, Value, Compare>::FlatMap(const Vector<value_type>& elems, SearchLayout layout) : m_keys(layout) {
+	build(elems);
+	}
+
+template<class Key, class Value, class Compare> FlatMap<Key, Value, Compare>::FlatMap(std::initializer_list<value_type> ls, SearchLayout layout) : m_keys(layout) {
+	build(Vector<value_type>(ls));
+	}
+
+template<class Key, class Value, class Compare> void FlatMap<Key, Value, Compare>::assign(const Vector<value_type>& elems) {
+	build(elems);
+	}
+
+// member functions
+
+template<class Key, class Value, class Compare> bool FlatMap<Key, Value, Compare>::empty() const {
+	return m_keys.empty();
+	}
+
+template<class Key, class Value, class Compare> typename FlatMap<Key, Value, Compare>::size_type FlatMap<Key, Value, Compare>::size() const {
+	return m_keys.size();
+	}
+
+template<class Key, class Value, class Compare> SearchLayout FlatMap<Key, Value, Compare>::layout() const {
+	return m_keys.layout();
+	}
+
+template<class Key, class Value, class Compare> typename FlatMap<Key, Value, Compare>::const_iterator FlatMap<Key, Value, Compare>::begin() const {
+	return const_iterator(m_keys.begin(), &m_values);
+	}
+
+template<class Key, class Value, class Compare> typename FlatMap<Key, Value, Compare>::const_iterator FlatMap<Key, Value, Compare>::end() const {
+	return const_iterator(m_keys.end(), &m_values);
+	}
+
+template<class Key, class Value, class Compare> bool FlatMap<Key, Value, Compare>::contains(const Key& key) const {
+	return m_keys.contains(key);
+	}
+
+template<class Key, class Value, class Compare> Value* FlatMap<Key, Value, Compare>::find(const Key& key) {
+	const size_type slot = m_keys.find_slot(key);
+	return slot == FlatSet<Key, Compare>::npos ? nullptr : &m_values[slot];
+	}
+
+template<class Key, class Value, class Compare> const Value* FlatMap<Key, Value, Compare>::find(const Key& key) const {
+	const size_type slot = m_keys.find_slot(key);
+	return slot == FlatSet<Key, Compare>::npos ? nullptr : &m_values[slot];
+	}
+
+template<class Key, class Value, class Compare> void FlatMap<Key, Value, Compare>::find_batch(const Key *first, const Key *last, const Value **values) const {
+	Vector<size_type> slots(last - first);
+	m_keys.find_slots(first, last, slots.begin());
+
+	for (size_type index = 0; index != slots.size(); ++index)
+		values[index] = slots[index] == FlatSet<Key, Compare>::npos ? nullptr : &m_values[slots[index]];
+	}
+
+template<class Key, class Value, class Compare> const FlatSet<Key, Compare>& FlatMap<Key, Value, Compare>::keys() const {
+	return m_keys;
+	}
+
+#endif // !FLAT_MAP_H
@@ -0,0 +1,348 @@
+#ifndef FLAT_SET_H
+#define FLAT_SET_H
+
+#include <algorithm>
+#include <functional>
+#include <initializer_list>
+#include "Vector.h"
+#include "Intrinsics.h"
+
+// memory order in which a FlatSet stores its elements
+enum class SearchLayout {
+	// ascending order, searched with a branchless binary search
+	Sorted,
+	// breadth first order of the implicit binary search tree, so that the top levels share
+	// a few cache lines and the descendants of a node can be prefetched (for very large sets)
+	Eytzinger
+	};
+
+// forward declaration
+template<class Key, class Value, class Compare> class FlatMap;
+
+template<class T, class Compare = std::less<T>> class FlatSet {
+public:
+	typedef std::size_t size_type;
+	typedef T value_type;
+
+	// slot returned by the find_slot functions when an element is not in the set
+	static const size_type npos = size_type(-1);
+
+	// walks the elements in ascending order regardless of the layout
+	class const_iterator {
+	private:
+		const FlatSet<T, Compare> *m_set;
+		size_type m_slot;
+
+	public:
+		const_iterator(const FlatSet<T, Compare> *set = nullptr, const size_type& slot = npos) : m_set(set), m_slot(slot) {}
+
+		const T& operator*() const { return m_set->m_data[m_slot]; }
+		const T* operator->() const { return &m_set->m_data[m_slot]; }
+
+		const_iterator& operator++() { m_slot = m_set->nextSlot(m_slot); return *this; }
+		const_iterator operator++(int) { const_iterator tmp = *this; ++*this; return tmp; }
+
+		bool operator==(const const_iterator& rhs) const { return m_slot == rhs.m_slot; }
+		bool operator!=(const const_iterator& rhs) const { return m_slot != rhs.m_slot; }
+
+		// position of the element in the underlying storage
+		size_type slot() const { return m_slot; }
+		};
+
+private:
+	Vector<T> m_data;
+	SearchLayout m_layout;
+	Compare m_comp;
+
+	// number of queries that find_slots searches in lockstep so that their cache misses overlap
+	static const size_type batchSize = 8;
+	// descendants of a node that the Eytzinger search prefetches at once. they are contiguous and, when
+	// sizeof(T) divides half a cache line, fill at most a line's worth of bytes, so they touch two lines at most
+	static const size_type prefetchSpan = cacheLineSize / sizeof(T) > 2 ? floorPowerOfTwo(cacheLineSize / sizeof(T)) : 2;
+
+	void build(Vector<T> elems);
+	void buildSorted(const Vector<T>& sortedElems);
+
+	bool equivalent(const T& lhs, const T& rhs) const;
+	size_type lowerBoundSlot(const T& elem) const;
+	size_type firstSlot() const;
+	size_type nextSlot(const size_type& slot) const;
+
+	template<class Key, class Value, class MapCompare> friend class FlatMap;
+
+public:
+	// constructors
+	explicit FlatSet(SearchLayout layout = SearchLayout::Sorted);
+	FlatSet(const Vector<T>& elems, SearchLayout layout = SearchLayout::Sorted);
+	FlatSet(std::initializer_list<T> ls, SearchLayout layout = SearchLayout::Sorted);
+
+	// replace the contents with the sorted, deduplicated elements of elems
+	void assign(const Vector<T>& elems);
+
+	// member functions
+	bool empty() const;
+	size_type size() const;
+	SearchLayout layout() const;
+
+	const_iterator begin() const;
+	const_iterator end() const;
+
+	bool contains(const T& elem) const;
+	size_type count(const T& elem) const;
+	const_iterator find(const T& elem) const;
+	const_iterator lower_bound(const T& elem) const;
+
+	// storage position of elem, or npos if it is not in the set
+	size_type find_slot(const T& elem) const;
+	// batched find_slot: writes the slot of every element in [first, last) to slots
+	void find_slots(const T *first, const T *last, size_type *slots) const;
+	Vector<bool> contains_batch(const Vector<T>& elems) const;
+
+	const T& at_slot(const size_type& slot) const;
+	};
+
+template<class T, class Compare> const typename FlatSet<T, Compare>::size_type FlatSet<T, Compare>::npos;
+template<class T, class Compare> const typename FlatSet<T, Compare>::size_type FlatSet<T, Compare>::batchSize;
+template<class T, class Compare> const typename FlatSet<T, Compare>::size_type FlatSet<T, Compare>::prefetchSpan;
+
+// private functions
+
+template<class T, class Compare> void FlatSet<T, Compare>::build(Vector<T> elems) {
+	std::sort(elems.begin(), elems.end(), m_comp);
+	typename Vector<T>::iterator uniqueEnd = std::unique(elems.begin(), elems.end(),
+		[this](const T& lhs, const T& rhs) { return equivalent(lhs, rhs); });
+
+	buildSorted(Vector<T>(elems.begin(), uniqueEnd));
+	}
+
+template<class T, class Compare> void FlatSet<T, Compare>::buildSorted(const Vector<T>& sortedElems) {
+	m_data = sortedElems;
+
+	if (m_layout == SearchLayout::Eytzinger) {
+		// an in-order walk of the tree visits the slots in ascending order
+		size_type slot = firstSlot();
+		for (const T& elem : sortedElems) {
+			m_data[slot] = elem;
+			slot = nextSlot(slot);
+			}
+		}
+	}
+
+template<class T, class Compare> inline bool FlatSet<T, Compare>::equivalent(const T& lhs, const T& rhs) const {
+	return !m_comp(lhs, rhs) && !m_comp(rhs, lhs);
+	}
+
+template<class T, class Compare> typename FlatSet<T, Compare>::size_type FlatSet<T, Compare>::lowerBoundSlot(const T& elem) const {
+	const size_type n = size();
+	const T *data = m_data.begin();
+
+	if (n == 0)
+		return npos;
+
+	if (m_layout == SearchLayout::Sorted) {
+		const T *base = data;
+		size_type len = n;
+		while (len > 1) {
+			const size_type half = len / 2;
+			// both candidates for the next probe
+			prefetch(base + len / 4);
+			prefetch(base + half + len / 4);
+			base += m_comp(base[half - 1], elem) ? half : 0;
+			len -= half;
+			}
+		const size_type rank = (base - data) + m_comp(*base, elem);
+		return rank == n ? npos : rank;
+		}
+
+	// nodes are numbered from 1 so that the children of node k are 2k and 2k + 1
+	size_type k = 1;
+	while (k <= n) {
+		// the storage is not cache line aligned, so fetch every line from the first byte of the descendants
+		// to their last one, which is two lines for most element sizes
+		const size_type descendant = prefetchSpan * k;
+		if (descendant <= n) {
+			const char *runFirst = reinterpret_cast<const char*>(data + descendant - 1);
+			const char *runLast = reinterpret_cast<const char*>(data + std::min(descendant + prefetchSpan - 1, n)) - 1;
+			for (const char *line = runFirst; line < runLast; line += cacheLineSize)
+				prefetch(line);
+			prefetch(runLast);
+			}
+		k = 2 * k + m_comp(data[k - 1], elem);
+		}
+	// undo the right turns taken after the last left turn, which was at the answer
+	k >>= countTrailingZeros(~std::uint64_t(k)) + 1;
+	return k == 0 ? npos : k - 1;
+	}
+
+template<class T, class Compare> typename FlatSet<T, Compare>::size_type FlatSet<T, Compare>::firstSlot() const {
+	const size_type n = size();
+	if (n == 0)
+		return npos;
+	if (m_layout == SearchLayout::Sorted)
+		return 0;
+
+	// leftmost node of the tree
+	size_type k = 1;
+	while (2 * k <= n)
+		k *= 2;
+	return k - 1;
+	}
+
+template<class T, class Compare> typename FlatSet<T, Compare>::size_type FlatSet<T, Compare>::nextSlot(const size_type& slot) const {
+	const size_type n = size();
+	if (m_layout == SearchLayout::Sorted)
+		return slot + 1 < n ? slot + 1 : npos;
+
+	size_type k = slot + 1;
+	if (2 * k + 1 <= n) {
+		// leftmost node of the right subtree
+		k = 2 * k + 1;
+		while (2 * k <= n)
+			k *= 2;
+		}
+	else {
+		// climb while coming from a right child, then once more
+		while (k & 1)
+			k >>= 1;
+		k >>= 1;
+		}
+	return k == 0 ? npos : k - 1;
+	}
+
+// constructors
+
+template<class T, class Compare> FlatSet<T, Compare>::FlatSet(SearchLayout layout) : m_layout(layout) {}
+
+template<class T, class Compare> FlatSet<T, Compare>::FlatSet(const Vector<T>& elems, SearchLayout layout) : m_layout(layout) {
+	build(elems);
+	}
+
+template<class T, class Compare> FlatSet<T, Compare>::FlatSet(std::initializer_list<T> ls, SearchLayout layout) : m_layout(layout) {
+	build(Vector<T>(ls));
+	}
+
+template<class T, class Compare> void FlatSet<T, Compare>::assign(const Vector<T>& elems) {
+	build(elems);
+	}
+
+// member functions
+
+template<class T, class Compare> bool FlatSet<T, Compare>::empty() const {
+	return m_data.empty();
+	}
+
+template<class T, class Compare> typename FlatSet<T, Compare>::size_type FlatSet<T, Compare>::size() const {
+	return m_data.size();
+	}
+
+template<class T, class Compare> SearchLayout FlatSet<T, Compare>::layout() const {
+	return m_layout;
+	}
+
+template<class T, class Compare> typename FlatSet<T, Compare>::const_iterator FlatSet<T, Compare>::begin() const {
+	return const_iterator(this, firstSlot());
+	}
+
+template<class T, class Compare> typename FlatSet<T, Compare>::const_iterator FlatSet<T, Compare>::end() const {
+	return const_iterator(this, npos);
+	}
+
+template<class T, class Compare> bool FlatSet<T, Compare>::contains(const T& elem) const {
+	return find_slot(elem) != npos;
+	}
+
+template<class T, class Compare> typename FlatSet<T, Compare>::size_type FlatSet<T, Compare>::count(const T& elem) const {
+	return contains(elem) ? 1 : 0;
+	}
+
+template<class T, class Compare> typename FlatSet<T, Compare>::const_iterator FlatSet<T, Compare>::find(const T& elem) const {
+	return const_iterator(this, find_slot(elem));
+	}
+
+template<class T, class Compare> typename FlatSet<T, Compare>::const_iterator FlatSet<T, Compare>::lower_bound(const T& elem) const {
+	return const_iterator(this, lowerBoundSlot(elem));
+	}
+
+template<class T, class Compare> typename FlatSet<T, Compare>::size_type FlatSet<T, Compare>::find_slot(const T& elem) const {
+	const size_type slot = lowerBoundSlot(elem);
+	return slot != npos && !m_comp(elem, m_data[slot]) ? slot : npos;
+	}
+
+template<class T, class Compare> void FlatSet<T, Compare>::find_slots(const T *first, const T *last, size_type *slots) const {
+	const size_type n = size();
+	const T *data = m_data.begin();
+
+	if (n == 0) {
+		std::fill(slots, slots + (last - first), npos);
+		return;
+		}
+
+	while (first != last) {
+		const size_type count = std::min(size_type(last - first), batchSize);
+
+		if (m_layout == SearchLayout::Sorted) {
+			// every query halves the same range length, so the whole batch moves in lockstep
+			const T *base[batchSize];
+			std::fill(base, base + count, data);
+			size_type len = n;
+			while (len > 1) {
+				const size_type half = len / 2;
+				const size_type nextHalf = (len - half) / 2;
+				for (size_type i = 0; i != count; ++i) {
+					base[i] += m_comp(base[i][half - 1], first[i]) ? half : 0;
+					if (nextHalf != 0)
+						prefetch(base[i] + nextHalf - 1);
+					}
+				len -= half;
+				}
+			for (size_type i = 0; i != count; ++i) {
+				const size_type rank = (base[i] - data) + m_comp(*base[i], first[i]);
+				slots[i] = rank == n ? npos : rank;
+				}
+			}
+		else {
+			size_type k[batchSize];
+			std::fill(k, k + count, size_type(1));
+			bool active = true;
+			while (active) {
+				active = false;
+				for (size_type i = 0; i != count; ++i) {
+					if (k[i] <= n) {
+						k[i] = 2 * k[i] + m_comp(data[k[i] - 1], first[i]);
+						if (k[i] <= n)
+							prefetch(data + k[i] - 1);
+						active = true;
+						}
+					}
+				}
+			for (size_type i = 0; i != count; ++i) {
+				const size_type node = k[i] >> (countTrailingZeros(~std::uint64_t(k[i])) + 1);
+				slots[i] = node == 0 ? npos : node - 1;
+				}
+			}
+
+		// turn the lower bounds into exact matches
+		for (size_type i = 0; i != count; ++i)
+			if (slots[i] != npos && m_comp(first[i], m_data[slots[i]]))
+				slots[i] = npos;
+
+		first += count;
+		slots += count;
+		}
+	}
+
+template<class T, class Compare> Vector<bool> FlatSet<T, Compare>::contains_batch(const Vector<T>& elems) const {
+	Vector<size_type> slots(elems.size());
+	find_slots(elems.begin(), elems.end(), slots.begin());
+
+	Vector<bool> found(elems.size());
+	for (size_type index = 0; index != slots.size(); ++index)
+		found[index] = slots[index] != npos;
+	return found;
+	}
+
+template<class T, class Compare> const T& FlatSet<T, Compare>::at_slot(const size_type& slot) const {
+	return m_data[slot];
+	}
+
+#endif // !FLAT_SET_H
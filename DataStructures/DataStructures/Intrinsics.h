@@ -0,0 +1,67 @@
+#ifndef INTRINSICS_H
+#define INTRINSICS_H
+
+#include <cstddef>
+#include <cstdint>
+#include <xmmintrin.h>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+// index of the lowest set bit of x (x must not be 0)
+inline unsigned countTrailingZeros(std::uint64_t x) {
+#ifdef _MSC_VER
+	unsigned long index;
+#ifdef _WIN64
+	_BitScanForward64(&index, x);
+#else
+	// 32 bit targets have no 64 bit bit scan, so scan each half
+	if (_BitScanForward(&index, static_cast<unsigned long>(x)))
+		return index;
+	_BitScanForward(&index, static_cast<unsigned long>(x >> 32));
+	index += 32;
+#endif
+	return index;
+#else
+	return __builtin_ctzll(x);
+#endif
+	}
+
+// number of set bits in x
+inline unsigned popCount(std::uint64_t x) {
+#ifdef _MSC_VER
+	return unsigned(__popcnt(static_cast<unsigned>(x)) + __popcnt(static_cast<unsigned>(x >> 32)));
+#else
+	return unsigned(__builtin_popcountll(x));
+#endif
+	}
+
+// index of the set bit of x that has rank set bits below it (x must have more than rank set bits)
+inline unsigned selectInWord(std::uint64_t x, unsigned rank) {
+	// skip whole bytes first, then clear the lowest set bits that remain below the answer
+	unsigned offset = 0;
+	for (unsigned byteCount = popCount(x & 0xff); byteCount <= rank; byteCount = popCount(x & 0xff)) {
+		rank -= byteCount;
+		x >>= 8;
+		offset += 8;
+		}
+	while (rank--)
+		x &= x - 1;
+	return offset + countTrailingZeros(x);
+	}
+
+// bytes in a cache line on the x86 targets this code is tuned for
+const std::size_t cacheLineSize = 64;
+
+// largest power of two that is not above n (n must not be 0)
+constexpr std::size_t floorPowerOfTwo(std::size_t n) {
+	return n & (n - 1) ? floorPowerOfTwo(n & (n - 1)) : n;
+	}
+
+// hint the cpu to start loading the cache line containing address into all cache levels
+inline void prefetch(const void *address) {
+	_mm_prefetch(static_cast<const char*>(address), _MM_HINT_T0);
+	}
+
+#endif // !INTRINSICS_H
@@ -0,0 +1,232 @@
+#ifndef INTRUSIVE_SLIST_H
+#define INTRUSIVE_SLIST_H
+
+#include <cstddef>
+
+// link embedded in an object so that the object can sit on an IntrusiveSList without an allocation.
+// an object can be on several lists at once by embedding one hook per list
+class SListHook {
+private:
+	// the next object on the list, or nullptr
+	void *m_next;
+
+	template<class T, SListHook T::*Hook> friend class IntrusiveSList;
+
+public:
+	SListHook() : m_next(nullptr) {}
+
+	// copying an object does not copy its place on a list
+	SListHook(const SListHook&) : m_next(nullptr) {}
+	SListHook& operator=(const SListHook&) { return *this; }
+	};
+
+// singly linked list of objects that are linked through their Hook member.
+// the list never allocates or copies: it only stores pointers to objects owned elsewhere,
+// which must stay alive while they are on the list
+template<class T, SListHook T::*Hook> class IntrusiveSList {
+public:
+	typedef std::size_t size_type;
+
+	class iterator {
+	private:
+		T *m_elem;
+
+	public:
+		iterator(T *elem = nullptr) : m_elem(elem) {}
+
+		T& operator*() const { return *m_elem; }
+		T* operator->() const { return m_elem; }
+
+		iterator& operator++() { m_elem = IntrusiveSList<T, Hook>::next(*m_elem); return *this; }
+		iterator operator++(int) { iterator tmp = *this; ++*this; return tmp; }
+
+		bool operator==(const iterator& rhs) const { return m_elem == rhs.m_elem; }
+		bool operator!=(const iterator& rhs) const { return m_elem != rhs.m_elem; }
+		};
+
+private:
+	T *m_head;
+	T *m_tail;
+	size_type m_size;
+
+	static T* next(const T& elem);
+	static void setNext(T& elem, T *nextElem);
+
+public:
+	IntrusiveSList();
+	IntrusiveSList(IntrusiveSList<T, Hook> &&sll) noexcept;
+
+	// a copy would link the same objects twice
+	IntrusiveSList(const IntrusiveSList<T, Hook>&) = delete;
+	IntrusiveSList<T, Hook>& operator=(const IntrusiveSList<T, Hook>&) = delete;
+
+	IntrusiveSList<T, Hook>& operator=(IntrusiveSList<T, Hook> &&rhs) noexcept;
+
+	bool empty() const;
+	size_type size() const;
+
+	iterator begin() const;
+	iterator end() const;
+
+	T& front() const;
+	T& back() const;
+
+	void push_front(T& elem);
+	void push_back(T& elem);
+	void pop_front();
+
+	// link elem directly after pos, which must be on this list
+	void insert_after(T& pos, T& elem);
+	// unlink the object after pos, which must not be the last object
+	void erase_after(T& pos);
+
+	// move every object of other to the end of this list, or after pos
+	void splice_back(IntrusiveSList<T, Hook>& other);
+	void splice_after(T& pos, IntrusiveSList<T, Hook>& other);
+
+	// unlink every object
+	void clear();
+
+	~IntrusiveSList();
+	};
+
+// private functions
+
+template<class T, SListHook T::*Hook> inline T* IntrusiveSList<T, Hook>::next(const T& elem) {
+	return static_cast<T*>((elem.*Hook).m_next);
+	}
+
+template<class T, SListHook T::*Hook> inline void IntrusiveSList<T, Hook>::setNext(T& elem, T *nextElem) {
+	(elem.*Hook).m_next = nextElem;
+	}
+
+// constructors
+
+template<class T, SListHook T::*Hook> IntrusiveSList<T, Hook>::IntrusiveSList() : m_head(nullptr), m_tail(nullptr), m_size(0) {}
+
+template<class T, SListHook T::*Hook> IntrusiveSList<T, Hook>::IntrusiveSList(IntrusiveSList<T, Hook> &&sll) noexcept {
+	// steal members of sll
+	m_head = sll.m_head;
+	m_tail = sll.m_tail;
+	m_size = sll.m_size;
+	// leave sll in state where destructor can be called
+	sll.m_head = sll.m_tail = nullptr;
+	sll.m_size = 0;
+	}
+
+template<class T, SListHook T::*Hook> IntrusiveSList<T, Hook>& IntrusiveSList<T, Hook>::operator=(IntrusiveSList<T, Hook> &&rhs) noexcept {
+	if (this != &rhs) {
+		clear();
+		// steal members of rhs
+		m_head = rhs.m_head;
+		m_tail = rhs.m_tail;
+		m_size = rhs.m_size;
+		// leave rhs in a state where the destructor can be called
+		rhs.m_head = rhs.m_tail = nullptr;
+		rhs.m_size = 0;
+		}
+	return *this;
+	}
+
+// member functions
+
+template<class T, SListHook T::*Hook> bool IntrusiveSList<T, Hook>::empty() const { return m_size == 0; }
+
+template<class T, SListHook T::*Hook> typename IntrusiveSList<T, Hook>::size_type IntrusiveSList<T, Hook>::size() const { return m_size; }
+
+template<class T, SListHook T::*Hook> typename IntrusiveSList<T, Hook>::iterator IntrusiveSList<T, Hook>::begin() const { return iterator(m_head); }
+
+template<class T, SListHook T::*Hook> typename IntrusiveSList<T, Hook>::iterator IntrusiveSList<T, Hook>::end() const { return iterator(nullptr); }
+
+template<class T, SListHook T::*Hook> T& IntrusiveSList<T, Hook>::front() const { return *m_head; }
+
+template<class T, SListHook T::*Hook> T& IntrusiveSList<T, Hook>::back() const { return *m_tail; }
+
+template<class T, SListHook T::*Hook> void IntrusiveSList<T, Hook>::push_front(T& elem) {
+	setNext(elem, m_head);
+	m_head = &elem;
+	if (m_tail == nullptr)
+		m_tail = &elem;
+	++m_size;
+	}
+
+template<class T, SListHook T::*Hook> void IntrusiveSList<T, Hook>::push_back(T& elem) {
+	setNext(elem, nullptr);
+	if (m_tail == nullptr)
+		m_head = &elem;
+	else
+		setNext(*m_tail, &elem);
+	m_tail = &elem;
+	++m_size;
+	}
+
+template<class T, SListHook T::*Hook> void IntrusiveSList<T, Hook>::pop_front() {
+	T *oldHead = m_head;
+	m_head = next(*oldHead);
+	if (m_head == nullptr)
+		m_tail = nullptr;
+	setNext(*oldHead, nullptr);
+	--m_size;
+	}
+
+template<class T, SListHook T::*Hook> void IntrusiveSList<T, Hook>::insert_after(T& pos, T& elem) {
+	setNext(elem, next(pos));
+	setNext(pos, &elem);
+	if (m_tail == &pos)
+		m_tail = &elem;
+	++m_size;
+	}
+
+template<class T, SListHook T::*Hook> void IntrusiveSList<T, Hook>::erase_after(T& pos) {
+	T *delElem = next(pos);
+	setNext(pos, next(*delElem));
+	if (m_tail == delElem)
+		m_tail = &pos;
+	setNext(*delElem, nullptr);
+	--m_size;
+	}
+
+template<class T, SListHook T::*Hook> void IntrusiveSList<T, Hook>::splice_back(IntrusiveSList<T, Hook>& other) {
+	if (other.empty() || &other == this)
+		return;
+
+	if (m_tail == nullptr)
+		m_head = other.m_head;
+	else
+		setNext(*m_tail, other.m_head);
+	m_tail = other.m_tail;
+	m_size += other.m_size;
+
+	other.m_head = other.m_tail = nullptr;
+	other.m_size = 0;
+	}
+
+template<class T, SListHook T::*Hook> void IntrusiveSList<T, Hook>::splice_after(T& pos, IntrusiveSList<T, Hook>& other) {
+	if (other.empty() || &other == this)
+		return;
+
+	setNext(*other.m_tail, next(pos));
+	setNext(pos, other.m_head);
+	if (m_tail == &pos)
+		m_tail = other.m_tail;
+	m_size += other.m_size;
+
+	other.m_head = other.m_tail = nullptr;
+	other.m_size = 0;
+	}
+
+template<class T, SListHook T::*Hook> void IntrusiveSList<T, Hook>::clear() {
+	while (m_head != nullptr) {
+		T *curElem = m_head;
+		m_head = next(*curElem);
+		setNext(*curElem, nullptr);
+		}
+	m_tail = nullptr;
+	m_size = 0;
+	}
+
+template<class T, SListHook T::*Hook> IntrusiveSList<T, Hook>::~IntrusiveSList() {
+	clear();
+	}
+
+#endif // !INTRUSIVE_SLIST_H
@@ -0,0 +1,183 @@
+#ifndef PACKED_INT_VECTOR_H
+#define PACKED_INT_VECTOR_H
+
+#include <cstdint>
+#include <initializer_list>
+#include <type_traits>
+#include "Vector.h"
+
+// vector of unsigned integers stored in exactly Bits bits each
+template<unsigned Bits> class PackedIntVector {
+	static_assert(Bits >= 1 && Bits <= 64, "PackedIntVector holds between 1 and 64 bits per element");
+
+public:
+	typedef std::size_t size_type;
+	typedef typename std::conditional<Bits <= 32, std::uint32_t, std::uint64_t>::type value_type;
+
+	// proxy returned by the non-const index operator
+	class reference {
+	private:
+		PackedIntVector<Bits> *m_vec;
+		size_type m_index;
+
+	public:
+		reference(PackedIntVector<Bits> *vec, const size_type& index) : m_vec(vec), m_index(index) {}
+
+		operator value_type() const { return m_vec->get(m_index); }
+		reference& operator=(const value_type& value) { m_vec->set(m_index, value); return *this; }
+		reference& operator=(const reference& rhs) { return *this = value_type(rhs); }
+		};
+
+	class const_iterator {
+	private:
+		const PackedIntVector<Bits> *m_vec;
+		size_type m_index;
+
+	public:
+		const_iterator(const PackedIntVector<Bits> *vec = nullptr, const size_type& index = 0) : m_vec(vec), m_index(index) {}
+
+		value_type operator*() const { return m_vec->get(m_index); }
+
+		const_iterator& operator++() { ++m_index; return *this; }
+		const_iterator operator++(int) { const_iterator tmp = *this; ++m_index; return tmp; }
+
+		bool operator==(const const_iterator& rhs) const { return m_index == rhs.m_index; }
+		bool operator!=(const const_iterator& rhs) const { return m_index != rhs.m_index; }
+		};
+
+private:
+	static const unsigned wordBits = 64;
+	static const std::uint64_t mask = ~std::uint64_t(0) >> (wordBits - Bits);
+
+	// always holds one word past the last element, so that get can read two words without a branch
+	Vector<std::uint64_t> m_words;
+	size_type m_size;
+
+	static size_type wordCount(const size_type& n);
+	void reserveWords(const size_type& n);
+	value_type get(const size_type& index) const;
+	void set(const size_type& index, const value_type& value);
+
+public:
+	//constructors
+	PackedIntVector();
+	explicit PackedIntVector(const size_type& n, const value_type& value = value_type());
+	PackedIntVector(std::initializer_list<value_type> ls);
+
+	// overloaded operators
+	reference operator[](const size_type& index);
+	value_type operator[](const size_type& index) const;
+
+	// member functions
+	bool empty() const;
+	size_type size() const;
+
+	const_iterator begin() const;
+	const_iterator end() const;
+
+	// values wider than Bits are truncated
+	void push_back(const value_type& value);
+
+	// allocate room for n elements, so that pushing up to n elements does not reallocate
+	void reserve(const size_type& n);
+	// release the memory reserved for future elements
+	void shrink_to_fit();
+
+	// bytes of heap memory held, including unused capacity
+	size_type memory_bytes() const;
+	};
+
+// private functions
+
+template<unsigned Bits> inline typename PackedIntVector<Bits>::size_type PackedIntVector<Bits>::wordCount(const size_type& n) {
+	// words touched by the first n elements plus the padding word
+	return (n * Bits + wordBits - 1) / wordBits + 1;
+	}
+
+template<unsigned Bits> inline void PackedIntVector<Bits>::reserveWords(const size_type& n) {
+	const size_type words = wordCount(n);
+	while (m_words.size() < words)
+		m_words.push_back(0);
+	}
+
+template<unsigned Bits> inline typename PackedIntVector<Bits>::value_type PackedIntVector<Bits>::get(const size_type& index) const {
+	const size_type bitPos = index * Bits;
+	const unsigned offset = bitPos % wordBits;
+	const std::uint64_t *word = m_words.begin() + bitPos / wordBits;
+	// the high part is shifted in two steps so that an offset of 0 does not shift by 64
+	return value_type(((word[0] >> offset) | ((word[1] << 1) << (wordBits - 1 - offset))) & mask);
+	}
+
+template<unsigned Bits> inline void PackedIntVector<Bits>::set(const size_type& index, const value_type& value) {
+	const size_type bitPos = index * Bits;
+	const unsigned offset = bitPos % wordBits;
+	std::uint64_t *word = m_words.begin() + bitPos / wordBits;
+	const std::uint64_t bits = std::uint64_t(value) & mask;
+
+	word[0] = (word[0] & ~(mask << offset)) | (bits << offset);
+	if (offset + Bits > wordBits)
+		word[1] = (word[1] & ~(mask >> (wordBits - offset))) | (bits >> (wordBits - offset));
+	}
+
+// constructors
+
+template<unsigned Bits> PackedIntVector<Bits>::PackedIntVector() : m_size(0) {
+	reserveWords(0);
+	}
+
+template<unsigned Bits> PackedIntVector<Bits>::PackedIntVector(const size_type& n, const value_type& value) : m_words(wordCount(n), 0), m_size(n) {
+	for (size_type index = 0; index != n; ++index)
+		set(index, value);
+	}
+
+template<unsigned Bits> PackedIntVector<Bits>::PackedIntVector(std::initializer_list<value_type> ls) : m_words(wordCount(ls.size()), 0), m_size(0) {
+	for (const value_type& value : ls)
+		push_back(value);
+	}
+
+// overloaded operators
+
+template<unsigned Bits> typename PackedIntVector<Bits>::reference PackedIntVector<Bits>::operator[](const size_type& index) {
+	return reference(this, index);
+	}
+
+template<unsigned Bits> typename PackedIntVector<Bits>::value_type PackedIntVector<Bits>::operator[](const size_type& index) const {
+	return get(index);
+	}
+
+// member functions
+
+template<unsigned Bits> bool PackedIntVector<Bits>::empty() const {
+	return m_size == 0;
+	}
+
+template<unsigned Bits> typename PackedIntVector<Bits>::size_type PackedIntVector<Bits>::size() const {
+	return m_size;
+	}
+
+template<unsigned Bits> typename PackedIntVector<Bits>::const_iterator PackedIntVector<Bits>::begin() const {
+	return const_iterator(this, 0);
+	}
+
+template<unsigned Bits> typename PackedIntVector<Bits>::const_iterator PackedIntVector<Bits>::end() const {
+	return const_iterator(this, m_size);
+	}
+
+template<unsigned Bits> void PackedIntVector<Bits>::push_back(const value_type& value) {
+	reserveWords(m_size + 1);
+	set(m_size++, value);
+	}
+
+template<unsigned Bits> void PackedIntVector<Bits>::reserve(const size_type& n) {
+	m_words.reserve(wordCount(n));
+	}
+
+template<unsigned Bits> void PackedIntVector<Bits>::shrink_to_fit() {
+	m_words.shrink_to_fit();
+	}
+
+template<unsigned Bits> typename PackedIntVector<Bits>::size_type PackedIntVector<Bits>::memory_bytes() const {
+	return (m_words.size() + m_words.reserved()) * sizeof(std::uint64_t);
+	}
+
+#endif // !PACKED_INT_VECTOR_H
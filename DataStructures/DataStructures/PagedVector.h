@@ -0,0 +1,350 @@
+#ifndef PAGED_VECTOR_H
+#define PAGED_VECTOR_H
+
+#include <algorithm>
+#include <memory>
+#include "Vector.h"
+
+// sparse vector whose elements are stored in pages of 2^PageBits elements, reached through a two level
+// page table of 2^TableBits pages per table. pages are allocated on the first write to them, and reads
+// of pages that were never written return a shared default value
+template<class T, std::size_t PageBits = 12, std::size_t TableBits = 10> class PagedVector {
+public:
+	typedef std::size_t size_type;
+	typedef T value_type;
+
+	// proxy returned by the non-const index operator, so that reads through it do not allocate pages
+	class reference {
+	private:
+		PagedVector<T, PageBits, TableBits> *m_vec;
+		size_type m_index;
+
+	public:
+		reference(PagedVector<T, PageBits, TableBits> *vec, const size_type& index) : m_vec(vec), m_index(index) {}
+
+		operator const T&() const { return static_cast<const PagedVector<T, PageBits, TableBits>&>(*m_vec)[m_index]; }
+		reference& operator=(const T& elem) { m_vec->set(m_index, elem); return *this; }
+		reference& operator=(const reference& rhs) { return *this = static_cast<const T&>(rhs); }
+		};
+
+	class const_iterator {
+	private:
+		const PagedVector<T, PageBits, TableBits> *m_vec;
+		size_type m_index;
+		// only visit elements of allocated pages
+		bool m_skipEmpty;
+
+	public:
+		const_iterator(const PagedVector<T, PageBits, TableBits> *vec = nullptr, const size_type& index = 0, bool skipEmpty = false)
+			: m_vec(vec), m_index(skipEmpty ? vec->nextPopulated(index) : index), m_skipEmpty(skipEmpty) {}
+
+		const T& operator*() const { return (*m_vec)[m_index]; }
+		const T* operator->() const { return &(*m_vec)[m_index]; }
+
+		const_iterator& operator++() {
+			++m_index;
+			if (m_skipEmpty && (m_index & (pageSize - 1)) == 0)
+				m_index = m_vec->nextPopulated(m_index);
+			return *this;
+			}
+		const_iterator operator++(int) { const_iterator tmp = *this; ++*this; return tmp; }
+
+		bool operator==(const const_iterator& rhs) const { return m_index == rhs.m_index; }
+		bool operator!=(const const_iterator& rhs) const { return m_index != rhs.m_index; }
+
+		// position of the current element in the vector
+		size_type index() const { return m_index; }
+		};
+
+private:
+	static const size_type pageSize = size_type(1) << PageBits;
+	static const size_type tableSize = size_type(1) << TableBits;
+
+	// each entry is nullptr or a table of tableSize page pointers, each of which is nullptr or a page
+	Vector<T**> m_directory;
+	size_type m_size;
+	size_type m_pageCount;
+	T m_default;
+	std::allocator<T> m_pageAlloc;
+	std::allocator<T*> m_tableAlloc;
+
+	void create(const PagedVector<T, PageBits, TableBits>& pv);
+	void uncreate();
+
+	void growDirectory(const size_type& n);
+	T* findPage(const size_type& index) const;
+	T* touchPage(const size_type& index);
+	void freePage(T **table, const size_type& slot);
+	size_type nextPopulated(size_type index) const;
+
+public:
+	//constructors
+	PagedVector();
+	explicit PagedVector(const size_type& n, const T& defaultElem = T());
+	PagedVector(const PagedVector<T, PageBits, TableBits>& pv);
+	PagedVector(PagedVector<T, PageBits, TableBits> &&pv) noexcept;
+
+	// overloaded operators
+	PagedVector<T, PageBits, TableBits>& operator=(const PagedVector<T, PageBits, TableBits>& rhs);
+	PagedVector<T, PageBits, TableBits>& operator=(PagedVector<T, PageBits, TableBits> &&rhs) noexcept;
+
+	// assigning through the returned reference writes with set, reading through it allocates nothing
+	reference operator[](const size_type& index);
+	const T& operator[](const size_type& index) const;
+
+	// member functions
+	bool empty() const;
+	size_type size() const;
+	const T& default_value() const;
+
+	// every element, including the ones on unallocated pages
+	const_iterator begin() const;
+	const_iterator end() const;
+
+	// only the elements on allocated pages
+	const_iterator populated_begin() const;
+	const_iterator populated_end() const;
+
+	// writing the default value to an unallocated page does not allocate it
+	void set(const size_type& index, const T& elem);
+	void push_back(const T& elem);
+
+	// free every page whose elements all equal the default value, returning the number freed
+	size_type release_default_pages();
+
+	size_type page_count() const;
+	// bytes of heap memory held by pages and page tables
+	size_type memory_bytes() const;
+
+	//destructor
+	~PagedVector();
+	};
+
+template<class T, std::size_t PageBits, std::size_t TableBits> const typename PagedVector<T, PageBits, TableBits>::size_type PagedVector<T, PageBits, TableBits>::pageSize;
+template<class T, std::size_t PageBits, std::size_t TableBits> const typename PagedVector<T, PageBits, TableBits>::size_type PagedVector<T, PageBits, TableBits>::tableSize;
+
+// private functions
+
+template<class T, std::size_t PageBits, std::size_t TableBits> void PagedVector<T, PageBits, TableBits>::create(const PagedVector<T, PageBits, TableBits>& pv) {
+	// copy only the pages that exist
+	growDirectory(pv.m_size);
+	for (size_type entry = 0; entry != pv.m_directory.size(); ++entry) {
+		if (pv.m_directory[entry] == nullptr)
+			continue;
+		for (size_type slot = 0; slot != tableSize; ++slot) {
+			const T *page = pv.m_directory[entry][slot];
+			if (page != nullptr)
+				std::copy(page, page + pageSize, touchPage((entry * tableSize + slot) << PageBits));
+			}
+		}
+	}
+
+template<class T, std::size_t PageBits, std::size_t TableBits> void PagedVector<T, PageBits, TableBits>::uncreate() {
+	for (size_type entry = 0; entry != m_directory.size(); ++entry) {
+		T **table = m_directory[entry];
+		if (table == nullptr)
+			continue;
+		for (size_type slot = 0; slot != tableSize; ++slot)
+			freePage(table, slot);
+		m_tableAlloc.deallocate(table, tableSize);
+		m_directory[entry] = nullptr;
+		}
+	}
+
+template<class T, std::size_t PageBits, std::size_t TableBits> void PagedVector<T, PageBits, TableBits>::growDirectory(const size_type& n) {
+	const size_type entries = (n + (pageSize << TableBits) - 1) >> (PageBits + TableBits);
+	while (m_directory.size() < entries)
+		m_directory.push_back(nullptr);
+	}
+
+template<class T, std::size_t PageBits, std::size_t TableBits> inline T* PagedVector<T, PageBits, TableBits>::findPage(const size_type& index) const {
+	T **table = m_directory[index >> (PageBits + TableBits)];
+	return table == nullptr ? nullptr : table[(index >> PageBits) & (tableSize - 1)];
+	}
+
+template<class T, std::size_t PageBits, std::size_t TableBits> T* PagedVector<T, PageBits, TableBits>::touchPage(const size_type& index) {
+	T **&table = m_directory[index >> (PageBits + TableBits)];
+	if (table == nullptr) {
+		table = m_tableAlloc.allocate(tableSize);
+		std::fill(table, table + tableSize, nullptr);
+		}
+
+	T *&page = table[(index >> PageBits) & (tableSize - 1)];
+	if (page == nullptr) {
+		page = m_pageAlloc.allocate(pageSize);
+		std::uninitialized_fill(page, page + pageSize, m_default);
+		++m_pageCount;
+		}
+	return page;
+	}
+
+template<class T, std::size_t PageBits, std::size_t TableBits> void PagedVector<T, PageBits, TableBits>::freePage(T **table, const size_type& slot) {
+	T *page = table[slot];
+	if (page == nullptr)
+		return;
+
+	// destroy elements in reverse
+	T *iter = page + pageSize;
+	while (iter != page)
+		m_pageAlloc.destroy(--iter);
+	m_pageAlloc.deallocate(page, pageSize);
+
+	table[slot] = nullptr;
+	--m_pageCount;
+	}
+
+template<class T, std::size_t PageBits, std::size_t TableBits> typename PagedVector<T, PageBits, TableBits>::size_type PagedVector<T, PageBits, TableBits>::nextPopulated(size_type index) const {
+	while (index < m_size) {
+		if (findPage(index) != nullptr)
+			return index;
+
+		// skip a whole table at once when it was never allocated
+		if (m_directory[index >> (PageBits + TableBits)] == nullptr)
+			index = ((index >> (PageBits + TableBits)) + 1) << (PageBits + TableBits);
+		else
+			index = ((index >> PageBits) + 1) << PageBits;
+		}
+	return m_size;
+	}
+
+// constructors
+
+template<class T, std::size_t PageBits, std::size_t TableBits> PagedVector<T, PageBits, TableBits>::PagedVector() : m_size(0), m_pageCount(0), m_default() {}
+
+template<class T, std::size_t PageBits, std::size_t TableBits> PagedVector<T, PageBits, TableBits>::PagedVector(const size_type& n, const T& defaultElem) : m_size(n), m_pageCount(0), m_default(defaultElem) {
+	growDirectory(n);
+	}
+
+template<class T, std::size_t PageBits, std::size_t TableBits> PagedVector<T, PageBits, TableBits>::PagedVector(const PagedVector<T, PageBits, TableBits>& pv) : m_size(pv.m_size), m_pageCount(0), m_default(pv.m_default) {
+	create(pv);
+	}
+
+template<class T, std::size_t PageBits, std::size_t TableBits> PagedVector<T, PageBits, TableBits>::PagedVector(PagedVector<T, PageBits, TableBits> &&pv) noexcept
+	: m_directory(std::move(pv.m_directory)), m_size(pv.m_size), m_pageCount(pv.m_pageCount), m_default(pv.m_default) {
+	// leave pv in a state where the destructor can be called
+	pv.m_size = pv.m_pageCount = 0;
+	}
+
+// overloaded operators
+
+template<class T, std::size_t PageBits, std::size_t TableBits> PagedVector<T, PageBits, TableBits>& PagedVector<T, PageBits, TableBits>::operator=(const PagedVector<T, PageBits, TableBits>& rhs) {
+	if (this != &rhs) {
+		uncreate();
+		m_size = rhs.m_size;
+		m_default = rhs.m_default;
+		create(rhs);
+		}
+	return *this;
+	}
+
+template<class T, std::size_t PageBits, std::size_t TableBits> PagedVector<T, PageBits, TableBits>& PagedVector<T, PageBits, TableBits>::operator=(PagedVector<T, PageBits, TableBits> &&rhs) noexcept {
+	if (this != &rhs) {
+		uncreate();
+		// steal members from rhs
+		m_directory = std::move(rhs.m_directory);
+		m_size = rhs.m_size;
+		m_pageCount = rhs.m_pageCount;
+		m_default = rhs.m_default;
+		// leave rhs in a state where the destructor can be called
+		rhs.m_size = rhs.m_pageCount = 0;
+		}
+	return *this;
+	}
+
+template<class T, std::size_t PageBits, std::size_t TableBits> typename PagedVector<T, PageBits, TableBits>::reference PagedVector<T, PageBits, TableBits>::operator[](const size_type& index) {
+	return reference(this, index);
+	}
+
+template<class T, std::size_t PageBits, std::size_t TableBits> const T& PagedVector<T, PageBits, TableBits>::operator[](const size_type& index) const {
+	const T *page = findPage(index);
+	return page == nullptr ? m_default : page[index & (pageSize - 1)];
+	}
+
+// member functions
+
+template<class T, std::size_t PageBits, std::size_t TableBits> bool PagedVector<T, PageBits, TableBits>::empty() const {
+	return m_size == 0;
+	}
+
+template<class T, std::size_t PageBits, std::size_t TableBits> typename PagedVector<T, PageBits, TableBits>::size_type PagedVector<T, PageBits, TableBits>::size() const {
+	return m_size;
+	}
+
+template<class T, std::size_t PageBits, std::size_t TableBits> const T& PagedVector<T, PageBits, TableBits>::default_value() const {
+	return m_default;
+	}
+
+template<class T, std::size_t PageBits, std::size_t TableBits> typename PagedVector<T, PageBits, TableBits>::const_iterator PagedVector<T, PageBits, TableBits>::begin() const {
+	return const_iterator(this, 0);
+	}
+
+template<class T, std::size_t PageBits, std::size_t TableBits> typename PagedVector<T, PageBits, TableBits>::const_iterator PagedVector<T, PageBits, TableBits>::end() const {
+	return const_iterator(this, m_size);
+	}
+
+template<class T, std::size_t PageBits, std::size_t TableBits> typename PagedVector<T, PageBits, TableBits>::const_iterator PagedVector<T, PageBits, TableBits>::populated_begin() const {
+	return const_iterator(this, 0, true);
+	}
+
+template<class T, std::size_t PageBits, std::size_t TableBits> typename PagedVector<T, PageBits, TableBits>::const_iterator PagedVector<T, PageBits, TableBits>::populated_end() const {
+	return const_iterator(this, m_size);
+	}
+
+template<class T, std::size_t PageBits, std::size_t TableBits> void PagedVector<T, PageBits, TableBits>::set(const size_type& index, const T& elem) {
+	T *page = findPage(index);
+	if (page != nullptr)
+		page[index & (pageSize - 1)] = elem;
+	else if (!(elem == m_default))
+		touchPage(index)[index & (pageSize - 1)] = elem;
+	}
+
+template<class T, std::size_t PageBits, std::size_t TableBits> void PagedVector<T, PageBits, TableBits>::push_back(const T& elem) {
+	growDirectory(++m_size);
+	set(m_size - 1, elem);
+	}
+
+template<class T, std::size_t PageBits, std::size_t TableBits> typename PagedVector<T, PageBits, TableBits>::size_type PagedVector<T, PageBits, TableBits>::release_default_pages() {
+	const size_type oldPageCount = m_pageCount;
+
+	for (size_type entry = 0; entry != m_directory.size(); ++entry) {
+		T **table = m_directory[entry];
+		if (table == nullptr)
+			continue;
+
+		bool tableEmpty = true;
+		for (size_type slot = 0; slot != tableSize; ++slot) {
+			const T *page = table[slot];
+			if (page == nullptr)
+				continue;
+			if (std::all_of(page, page + pageSize, [this](const T& elem) { return elem == m_default; }))
+				freePage(table, slot);
+			else
+				tableEmpty = false;
+			}
+
+		if (tableEmpty) {
+			m_tableAlloc.deallocate(table, tableSize);
+			m_directory[entry] = nullptr;
+			}
+		}
+	return oldPageCount - m_pageCount;
+	}
+
+template<class T, std::size_t PageBits, std::size_t TableBits> typename PagedVector<T, PageBits, TableBits>::size_type PagedVector<T, PageBits, TableBits>::page_count() const {
+	return m_pageCount;
+	}
+
+template<class T, std::size_t PageBits, std::size_t TableBits> typename PagedVector<T, PageBits, TableBits>::size_type PagedVector<T, PageBits, TableBits>::memory_bytes() const {
+	size_type tables = 0;
+	for (size_type entry = 0; entry != m_directory.size(); ++entry)
+		tables += m_directory[entry] != nullptr;
+
+	return m_pageCount * pageSize * sizeof(T) + tables * tableSize * sizeof(T*)
+		+ (m_directory.size() + m_directory.reserved()) * sizeof(T**);
+	}
+
+template<class T, std::size_t PageBits, std::size_t TableBits> PagedVector<T, PageBits, TableBits>::~PagedVector() {
+	uncreate();
+	}
+
+#endif // !PAGED_VECTOR_H
@@ -0,0 +1,304 @@
+#ifndef PRIORITY_QUEUE_H
+#define PRIORITY_QUEUE_H
+
+#include <algorithm>
+#include <functional>
+#include <initializer_list>
+#include <utility>
+#include "Vector.h"
+
+// D-ary heap kept in a Vector. like std::priority_queue, top() is the greatest element according to Compare,
+// so use std::greater for a min-heap. with TrackPositions set, push hands out a handle per element that
+// update, decrease_key and erase use to find the element in the heap
+template<class T, class Compare = std::less<T>, std::size_t D = 4, bool TrackPositions = false> class PriorityQueue {
+	static_assert(D >= 2, "PriorityQueue needs an arity of at least 2");
+
+public:
+	typedef std::size_t size_type;
+	typedef T value_type;
+	typedef size_type handle_type;
+
+private:
+	Vector<T> m_heap;
+	Compare m_comp;
+
+	// only used with TrackPositions: the handle of the element in each heap slot,
+	// the heap slot of each handle, and handles that are free to hand out again
+	Vector<handle_type> m_handles;
+	Vector<size_type> m_positions;
+	Vector<handle_type> m_freeHandles;
+
+	static size_type parent(const size_type& index);
+	static size_type firstChild(const size_type& index);
+
+	void place(const size_type& index, T&& elem, const handle_type& handle);
+	handle_type newHandle();
+	size_type siftUp(size_type index);
+	size_type siftDown(size_type index);
+	size_type greatestChild(const size_type& child, const size_type& lastChild) const;
+	void popTop();
+	void heapify();
+	void removeAt(const size_type& index);
+	void trackAll();
+
+public:
+	//constructors
+	PriorityQueue();
+	// builds the heap in O(n). with TrackPositions, element i of elems gets handle i
+	explicit PriorityQueue(const Vector<T>& elems);
+	explicit PriorityQueue(Vector<T> &&elems);
+	PriorityQueue(std::initializer_list<T> ls);
+
+	// member functions
+	bool empty() const;
+	size_type size() const;
+
+	const T& top() const;
+
+	// the returned handle is only meaningful with TrackPositions
+	handle_type push(const T& elem);
+	// bulk push, rebuilding the heap in O(n) when that is cheaper than sifting each element.
+	// with TrackPositions, the handle of each element is written to handles if it is not nullptr
+	void push(const T *first, const T *last, handle_type *handles = nullptr);
+	void pop();
+
+	// TrackPositions only: the element of a handle, and changing or removing it in O(D log n)
+	const T& get(const handle_type& handle) const;
+	void update(const handle_type& handle, const T& elem);
+	// elem must not compare less than the current element, so it can only move towards the top
+	void decrease_key(const handle_type& handle, const T& elem);
+	void erase(const handle_type& handle);
+	};
+
+// private functions
+
+template<class T, class Compare, std::size_t D, bool TrackPositions> inline typename PriorityQueue<T, Compare, D, TrackPositions>::size_type PriorityQueue<T, Compare, D, TrackPositions>::parent(const size_type& index) {
+	return (index - 1) / D;
+	}
+
+template<class T, class Compare, std::size_t D, bool TrackPositions> inline typename PriorityQueue<T, Compare, D, TrackPositions>::size_type PriorityQueue<T, Compare, D, TrackPositions>::firstChild(const size_type& index) {
+	return D * index + 1;
+	}
+
+template<class T, class Compare, std::size_t D, bool TrackPositions> inline void PriorityQueue<T, Compare, D, TrackPositions>::place(const size_type& index, T&& elem, const handle_type& handle) {
+	m_heap[index] = std::move(elem);
+	if (TrackPositions) {
+		m_handles[index] = handle;
+		m_positions[handle] = index;
+		}
+	}
+
+template<class T, class Compare, std::size_t D, bool TrackPositions> typename PriorityQueue<T, Compare, D, TrackPositions>::handle_type PriorityQueue<T, Compare, D, TrackPositions>::newHandle() {
+	if (!TrackPositions)
+		return 0;
+
+	if (m_freeHandles.empty()) {
+		m_positions.push_back(0);
+		return m_positions.size() - 1;
+		}
+	const handle_type handle = m_freeHandles[m_freeHandles.size() - 1];
+	m_freeHandles.pop_back();
+	return handle;
+	}
+
+template<class T, class Compare, std::size_t D, bool TrackPositions> typename PriorityQueue<T, Compare, D, TrackPositions>::size_type PriorityQueue<T, Compare, D, TrackPositions>::siftUp(size_type index) {
+	// move parents down into the hole until the element fits
+	T elem = std::move(m_heap[index]);
+	const handle_type handle = TrackPositions ? m_handles[index] : 0;
+
+	while (index != 0 && m_comp(m_heap[parent(index)], elem)) {
+		const size_type parentIndex = parent(index);
+		place(index, std::move(m_heap[parentIndex]), TrackPositions ? m_handles[parentIndex] : 0);
+		index = parentIndex;
+		}
+	place(index, std::move(elem), handle);
+	return index;
+	}
+
+template<class T, class Compare, std::size_t D, bool TrackPositions> inline typename PriorityQueue<T, Compare, D, TrackPositions>::size_type PriorityQueue<T, Compare, D, TrackPositions>::greatestChild(const size_type& child, const size_type& lastChild) const {
+	// written as a select so that the compiler can avoid a branch per child
+	size_type bestChild = child;
+	for (size_type index = child + 1; index < lastChild; ++index)
+		bestChild = m_comp(m_heap[bestChild], m_heap[index]) ? index : bestChild;
+	return bestChild;
+	}
+
+template<class T, class Compare, std::size_t D, bool TrackPositions> typename PriorityQueue<T, Compare, D, TrackPositions>::size_type PriorityQueue<T, Compare, D, TrackPositions>::siftDown(size_type index) {
+	const size_type n = m_heap.size();
+	T elem = std::move(m_heap[index]);
+	const handle_type handle = TrackPositions ? m_handles[index] : 0;
+
+	// move the greatest child up into the hole until the element fits
+	for (size_type child = firstChild(index); child < n; child = firstChild(index)) {
+		const size_type bestChild = greatestChild(child, std::min(child + D, n));
+		if (!m_comp(elem, m_heap[bestChild]))
+			break;
+		place(index, std::move(m_heap[bestChild]), TrackPositions ? m_handles[bestChild] : 0);
+		index = bestChild;
+		}
+	place(index, std::move(elem), handle);
+	return index;
+	}
+
+template<class T, class Compare, std::size_t D, bool TrackPositions> void PriorityQueue<T, Compare, D, TrackPositions>::popTop() {
+	const size_type last = m_heap.size() - 1;
+	if (TrackPositions)
+		m_freeHandles.push_back(m_handles[0]);
+
+	// the last element almost always belongs near the bottom, so move the hole left by the top all the way
+	// down without comparing against it and then sift the last element up from there
+	size_type index = 0;
+	for (size_type child = firstChild(index); child < last; child = firstChild(index)) {
+		const size_type bestChild = greatestChild(child, std::min(child + D, last));
+		place(index, std::move(m_heap[bestChild]), TrackPositions ? m_handles[bestChild] : 0);
+		index = bestChild;
+		}
+	if (index != last) {
+		place(index, std::move(m_heap[last]), TrackPositions ? m_handles[last] : 0);
+		siftUp(index);
+		}
+	m_heap.pop_back();
+	if (TrackPositions)
+		m_handles.pop_back();
+	}
+
+template<class T, class Compare, std::size_t D, bool TrackPositions> void PriorityQueue<T, Compare, D, TrackPositions>::heapify() {
+	// sift down every node that has children, from the last one up
+	const size_type n = m_heap.size();
+	if (n < 2)
+		return;
+	for (size_type index = parent(n - 1) + 1; index-- != 0; )
+		siftDown(index);
+	}
+
+template<class T, class Compare, std::size_t D, bool TrackPositions> void PriorityQueue<T, Compare, D, TrackPositions>::removeAt(const size_type& index) {
+	const size_type last = m_heap.size() - 1;
+	if (TrackPositions)
+		m_freeHandles.push_back(m_handles[index]);
+
+	if (index != last) {
+		// fill the hole with the last element and restore the heap in whichever direction it is broken
+		place(index, std::move(m_heap[last]), TrackPositions ? m_handles[last] : 0);
+		m_heap.pop_back();
+		if (TrackPositions)
+			m_handles.pop_back();
+		if (siftUp(index) == index)
+			siftDown(index);
+		}
+	else {
+		m_heap.pop_back();
+		if (TrackPositions)
+			m_handles.pop_back();
+		}
+	}
+
+template<class T, class Compare, std::size_t D, bool TrackPositions> void PriorityQueue<T, Compare, D, TrackPositions>::trackAll() {
+	if (!TrackPositions)
+		return;
+	for (size_type index = 0; index != m_heap.size(); ++index) {
+		m_handles.push_back(index);
+		m_positions.push_back(index);
+		}
+	}
+
+// constructors
+
+template<class T, class Compare, std::size_t D, bool TrackPositions> PriorityQueue<T, Compare, D, TrackPositions>::PriorityQueue() {}
+
+template<class T, class Compare, std::size_t D, bool TrackPositions> PriorityQueue<T, Compare, D, TrackPositions>::PriorityQueue(const Vector<T>& elems) : m_heap(elems) {
+	trackAll();
+	heapify();
+	}
+
+template<class T, class Compare, std::size_t D, bool TrackPositions> PriorityQueue<T, Compare, D, TrackPositions>::PriorityQueue(Vector<T> &&elems) : m_heap(std::move(elems)) {
+	trackAll();
+	heapify();
+	}
+
+template<class T, class Compare, std::size_t D, bool TrackPositions> PriorityQueue<T, Compare, D, TrackPositions>::PriorityQueue(std::initializer_list<T> ls) : m_heap(ls) {
+	trackAll();
+	heapify();
+	}
+
+// member functions
+
+template<class T, class Compare, std::size_t D, bool TrackPositions> bool PriorityQueue<T, Compare, D, TrackPositions>::empty() const {
+	return m_heap.empty();
+	}
+
+template<class T, class Compare, std::size_t D, bool TrackPositions> typename PriorityQueue<T, Compare, D, TrackPositions>::size_type PriorityQueue<T, Compare, D, TrackPositions>::size() const {
+	return m_heap.size();
+	}
+
+template<class T, class Compare, std::size_t D, bool TrackPositions> const T& PriorityQueue<T, Compare, D, TrackPositions>::top() const {
+	return m_heap[0];
+	}
+
+template<class T, class Compare, std::size_t D, bool TrackPositions> typename PriorityQueue<T, Compare, D, TrackPositions>::handle_type PriorityQueue<T, Compare, D, TrackPositions>::push(const T& elem) {
+	const handle_type handle = newHandle();
+	m_heap.push_back(elem);
+	if (TrackPositions) {
+		m_handles.push_back(handle);
+		m_positions[handle] = m_heap.size() - 1;
+		}
+	siftUp(m_heap.size() - 1);
+	return handle;
+	}
+
+template<class T, class Compare, std::size_t D, bool TrackPositions> void PriorityQueue<T, Compare, D, TrackPositions>::push(const T *first, const T *last, handle_type *handles) {
+	const size_type oldSize = m_heap.size();
+	const size_type count = last - first;
+
+	for (size_type index = 0; index != count; ++index) {
+		const handle_type handle = newHandle();
+		m_heap.push_back(first[index]);
+		if (TrackPositions) {
+			m_handles.push_back(handle);
+			m_positions[handle] = oldSize + index;
+			if (handles)
+				handles[index] = handle;
+			}
+		}
+
+	// sifting each element up costs about count * log(n) against n for rebuilding the whole heap
+	size_type depth = 0;
+	for (size_type levelEnd = 1; levelEnd < m_heap.size(); levelEnd = levelEnd * D + 1)
+		++depth;
+
+	if (count * depth > m_heap.size())
+		heapify();
+	else
+		for (size_type index = oldSize; index != m_heap.size(); ++index)
+			siftUp(index);
+	}
+
+template<class T, class Compare, std::size_t D, bool TrackPositions> void PriorityQueue<T, Compare, D, TrackPositions>::pop() {
+	popTop();
+	}
+
+template<class T, class Compare, std::size_t D, bool TrackPositions> const T& PriorityQueue<T, Compare, D, TrackPositions>::get(const handle_type& handle) const {
+	static_assert(TrackPositions, "get needs a PriorityQueue that tracks positions");
+	return m_heap[m_positions[handle]];
+	}
+
+template<class T, class Compare, std::size_t D, bool TrackPositions> void PriorityQueue<T, Compare, D, TrackPositions>::update(const handle_type& handle, const T& elem) {
+	static_assert(TrackPositions, "update needs a PriorityQueue that tracks positions");
+	const size_type index = m_positions[handle];
+	m_heap[index] = elem;
+	if (siftUp(index) == index)
+		siftDown(index);
+	}
+
+template<class T, class Compare, std::size_t D, bool TrackPositions> void PriorityQueue<T, Compare, D, TrackPositions>::decrease_key(const handle_type& handle, const T& elem) {
+	static_assert(TrackPositions, "decrease_key needs a PriorityQueue that tracks positions");
+	const size_type index = m_positions[handle];
+	m_heap[index] = elem;
+	siftUp(index);
+	}
+
+template<class T, class Compare, std::size_t D, bool TrackPositions> void PriorityQueue<T, Compare, D, TrackPositions>::erase(const handle_type& handle) {
+	static_assert(TrackPositions, "erase needs a PriorityQueue that tracks positions");
+	removeAt(m_positions[handle]);
+	}
+
+#endif // !PRIORITY_QUEUE_H
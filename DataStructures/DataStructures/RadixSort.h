@@ -0,0 +1,281 @@
+#ifndef RADIX_SORT_H
+#define RADIX_SORT_H
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "Vector.h"
+
+// maps a key to an unsigned integer whose order matches the key's order.
+// specialise it to radix sort on keys of other types
+template<class K, class Enable = void> struct RadixKey;
+
+template<class K> struct RadixKey<K, typename std::enable_if<std::is_integral<K>::value && std::is_unsigned<K>::value>::type> {
+	typedef K type;
+	static type encode(const K& key) { return key; }
+	};
+
+template<class K> struct RadixKey<K, typename std::enable_if<std::is_integral<K>::value && std::is_signed<K>::value>::type> {
+	typedef typename std::make_unsigned<K>::type type;
+	// flipping the sign bit puts negative numbers first
+	static type encode(const K& key) { return type(key) ^ type(type(1) << (8 * sizeof(K) - 1)); }
+	};
+
+template<class K> struct RadixKey<K, typename std::enable_if<std::is_floating_point<K>::value>::type> {
+	static_assert(sizeof(K) == 4 || sizeof(K) == 8, "RadixKey supports IEEE single and double precision");
+	typedef typename std::conditional<sizeof(K) == 4, std::uint32_t, std::uint64_t>::type type;
+
+	// flip every bit of negative numbers and only the sign bit of positive ones
+	static type encode(const K& key) {
+		type bits;
+		std::memcpy(&bits, &key, sizeof(bits));
+		const type signBit = type(1) << (8 * sizeof(type) - 1);
+		return bits & signBit ? ~bits : bits | signBit;
+		}
+	};
+
+// key extractor that sorts elements by their own value
+struct RadixIdentity {
+	template<class K> const K& operator()(const K& key) const { return key; }
+	};
+
+// radix sorts a Vector in place, keeping its scratch buffer between calls
+template<class T> class RadixSorter {
+public:
+	typedef typename Vector<T>::size_type size_type;
+
+private:
+	static const unsigned digitBits = 8;
+	static const size_type radix = size_type(1) << digitBits;
+	// below this many elements a thread costs more than it saves
+	static const size_type minElementsPerThread = 1 << 16;
+	// buckets this small are finished by insertion sort in sort_msd
+	static const size_type msdInsertionSize = 64;
+
+	Vector<T> m_scratch;
+	unsigned m_threads;
+
+	template<class KeyFn> void scatter(const T *src, T *dst, const size_type& n, const unsigned& shift, KeyFn& key, const size_type *count) const;
+	template<class KeyFn> void parallelScatter(const T *src, T *dst, const size_type& n, const unsigned& shift, KeyFn& key) const;
+	template<class KeyFn> void msd(T *first, T *last, KeyFn& key, const unsigned& shift);
+
+public:
+	explicit RadixSorter(unsigned threads = 1);
+
+	// number of threads used by sort, 1 to sort on the calling thread only
+	void set_threads(unsigned threads);
+	unsigned threads() const;
+
+	// stable least significant digit first sort, by key(elem) if given
+	void sort(Vector<T>& vec);
+	template<class KeyFn> void sort(Vector<T>& vec, KeyFn key);
+
+	// unstable most significant digit first sort that permutes in place and needs no scratch buffer
+	void sort_msd(Vector<T>& vec);
+	template<class KeyFn> void sort_msd(Vector<T>& vec, KeyFn key);
+
+	// release the scratch buffer
+	void clear_scratch();
+	};
+
+// convenience functions that do not keep the scratch buffer
+template<class T> void radix_sort(Vector<T>& vec) {
+	RadixSorter<T>().sort(vec);
+	}
+
+template<class T, class KeyFn> void radix_sort(Vector<T>& vec, KeyFn key) {
+	RadixSorter<T>().sort(vec, key);
+	}
+
+// private functions
+
+template<class T> template<class KeyFn> void RadixSorter<T>::scatter(const T *src, T *dst, const size_type& n, const unsigned& shift, KeyFn& key, const size_type *count) const {
+	typedef RadixKey<typename std::decay<decltype(key(*src))>::type> Key;
+
+	size_type offset[radix];
+	size_type running = 0;
+	for (size_type digit = 0; digit != radix; ++digit) {
+		offset[digit] = running;
+		running += count[digit];
+		}
+
+	for (const T *iter = src; iter != src + n; ++iter)
+		dst[offset[(Key::encode(key(*iter)) >> shift) & (radix - 1)]++] = *iter;
+	}
+
+template<class T> template<class KeyFn> void RadixSorter<T>::parallelScatter(const T *src, T *dst, const size_type& n, const unsigned& shift, KeyFn& key) const {
+	typedef RadixKey<typename std::decay<decltype(key(*src))>::type> Key;
+
+	const unsigned threadCount = unsigned(std::min<size_type>(m_threads, n / minElementsPerThread + 1));
+	const size_type chunk = (n + threadCount - 1) / threadCount;
+
+	// histogram of each thread's chunk, then turned into the chunk's first position for every digit
+	Vector<size_type> offsets(threadCount * radix, 0);
+	std::vector<std::thread> workers;
+	for (unsigned thread = 0; thread != threadCount; ++thread) {
+		workers.emplace_back([&, thread]() {
+			const T *first = src + std::min(n, thread * chunk);
+			const T *last = src + std::min(n, (thread + 1) * chunk);
+			size_type *count = offsets.begin() + thread * radix;
+			for (const T *iter = first; iter != last; ++iter)
+				++count[(Key::encode(key(*iter)) >> shift) & (radix - 1)];
+			});
+		}
+	for (std::thread& worker : workers)
+		worker.join();
+	workers.clear();
+
+	// elements keep their order because earlier chunks get earlier positions within each digit
+	size_type running = 0;
+	for (size_type digit = 0; digit != radix; ++digit) {
+		for (unsigned thread = 0; thread != threadCount; ++thread) {
+			const size_type count = offsets[thread * radix + digit];
+			offsets[thread * radix + digit] = running;
+			running += count;
+			}
+		}
+
+	for (unsigned thread = 0; thread != threadCount; ++thread) {
+		workers.emplace_back([&, thread]() {
+			const T *first = src + std::min(n, thread * chunk);
+			const T *last = src + std::min(n, (thread + 1) * chunk);
+			size_type *offset = offsets.begin() + thread * radix;
+			for (const T *iter = first; iter != last; ++iter)
+				dst[offset[(Key::encode(key(*iter)) >> shift) & (radix - 1)]++] = *iter;
+			});
+		}
+	for (std::thread& worker : workers)
+		worker.join();
+	}
+
+template<class T> template<class KeyFn> void RadixSorter<T>::msd(T *first, T *last, KeyFn& key, const unsigned& shift) {
+	typedef RadixKey<typename std::decay<decltype(key(*first))>::type> Key;
+
+	// empty buckets are passed in too, where first + 1 would be past the end
+	if (last - first < 2)
+		return;
+	if (size_type(last - first) < msdInsertionSize) {
+		for (T *iter = first + 1; iter < last; ++iter)
+			for (T *pos = iter; pos != first && Key::encode(key(*pos)) < Key::encode(key(*(pos - 1))); --pos)
+				std::swap(*pos, *(pos - 1));
+		return;
+		}
+
+	size_type count[radix] = {};
+	for (T *iter = first; iter != last; ++iter)
+		++count[(Key::encode(key(*iter)) >> shift) & (radix - 1)];
+
+	// a digit shared by every element does not split the range
+	if (count[(Key::encode(key(*first)) >> shift) & (radix - 1)] == size_type(last - first)) {
+		if (shift != 0)
+			msd(first, last, key, shift - digitBits);
+		return;
+		}
+
+	size_type head[radix];
+	size_type tail[radix];
+	size_type running = 0;
+	for (size_type digit = 0; digit != radix; ++digit) {
+		head[digit] = running;
+		running += count[digit];
+		tail[digit] = running;
+		}
+
+	// swap every element straight into the next free place of its bucket
+	for (size_type digit = 0; digit != radix; ++digit) {
+		while (head[digit] != tail[digit]) {
+			T& elem = first[head[digit]];
+			const size_type elemDigit = (Key::encode(key(elem)) >> shift) & (radix - 1);
+			if (elemDigit == digit)
+				++head[digit];
+			else
+				std::swap(elem, first[head[elemDigit]++]);
+			}
+		}
+
+	if (shift == 0)
+		return;
+	T *bucket = first;
+	for (size_type digit = 0; digit != radix; ++digit) {
+		msd(bucket, bucket + count[digit], key, shift - digitBits);
+		bucket += count[digit];
+		}
+	}
+
+// constructors
+
+template<class T> RadixSorter<T>::RadixSorter(unsigned threads) : m_threads(std::max(threads, 1u)) {}
+
+// member functions
+
+template<class T> void RadixSorter<T>::set_threads(unsigned threads) {
+	m_threads = std::max(threads, 1u);
+	}
+
+template<class T> unsigned RadixSorter<T>::threads() const {
+	return m_threads;
+	}
+
+template<class T> void RadixSorter<T>::sort(Vector<T>& vec) {
+	sort(vec, RadixIdentity());
+	}
+
+template<class T> template<class KeyFn> void RadixSorter<T>::sort(Vector<T>& vec, KeyFn key) {
+	typedef RadixKey<typename std::decay<decltype(key(*vec.begin()))>::type> Key;
+	const unsigned passes = sizeof(typename Key::type);
+
+	const size_type n = vec.size();
+	if (n < 2)
+		return;
+	if (m_scratch.size() < n)
+		m_scratch = Vector<T>(n);
+
+	// histograms of every digit in a single read
+	Vector<size_type> counts(passes * radix, 0);
+	for (const T& elem : vec) {
+		const typename Key::type bits = Key::encode(key(elem));
+		for (unsigned pass = 0; pass != passes; ++pass)
+			++counts[pass * radix + ((bits >> (pass * digitBits)) & (radix - 1))];
+		}
+
+	T *src = vec.begin();
+	T *dst = m_scratch.begin();
+	for (unsigned pass = 0; pass != passes; ++pass) {
+		const unsigned shift = pass * digitBits;
+		const size_type *count = counts.begin() + pass * radix;
+
+		// a digit shared by every element would leave the order unchanged
+		if (count[(Key::encode(key(*src)) >> shift) & (radix - 1)] == n)
+			continue;
+
+		if (m_threads > 1 && n >= 2 * minElementsPerThread)
+			parallelScatter(src, dst, n, shift, key);
+		else
+			scatter(src, dst, n, shift, key, count);
+		std::swap(src, dst);
+		}
+
+	if (src != vec.begin())
+		std::copy(src, src + n, vec.begin());
+	}
+
+template<class T> void RadixSorter<T>::sort_msd(Vector<T>& vec) {
+	sort_msd(vec, RadixIdentity());
+	}
+
+template<class T> template<class KeyFn> void RadixSorter<T>::sort_msd(Vector<T>& vec, KeyFn key) {
+	typedef RadixKey<typename std::decay<decltype(key(*vec.begin()))>::type> Key;
+
+	if (vec.size() > 1)
+		msd(vec.begin(), vec.end(), key, unsigned(8 * sizeof(typename Key::type) - digitBits));
+	}
+
+template<class T> void RadixSorter<T>::clear_scratch() {
+	m_scratch = Vector<T>();
+	}
+
+#endif // !RADIX_SORT_H
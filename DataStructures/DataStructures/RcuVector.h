@@ -0,0 +1,243 @@
+#ifndef RCU_VECTOR_H
+#define RCU_VECTOR_H
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <stdexcept>
+#include <utility>
+#include "Vector.h"
+
+// Vector for data that is read by many threads and replaced rarely. readers pin the current version
+// without locking or waiting, writers publish a whole new version with a single atomic store, and old
+// versions are deleted once no reader that could have seen them is still pinned.
+//
+// every reading thread registers once to get one of MaxReaders slots, in which it announces the epoch
+// it pinned in. a version retired in epoch e can go once every slot is quiescent or announces a later epoch
+template<class T, std::size_t MaxReaders = 64> class RcuVector {
+public:
+	typedef typename Vector<T>::size_type size_type;
+	typedef typename Vector<T>::const_iterator const_iterator;
+
+	class reader;
+
+	// a pinned version, which stays alive and unchanged until the snapshot is destroyed
+	class snapshot {
+	private:
+		reader *m_reader;
+		const Vector<T> *m_vec;
+
+		friend class reader;
+		snapshot(reader *rdr, const Vector<T> *vec) : m_reader(rdr), m_vec(vec) {}
+
+	public:
+		snapshot(snapshot &&snap) noexcept : m_reader(snap.m_reader), m_vec(snap.m_vec) { snap.m_reader = nullptr; }
+		snapshot(const snapshot&) = delete;
+		snapshot& operator=(const snapshot&) = delete;
+
+		const Vector<T>& operator*() const { return *m_vec; }
+		const Vector<T>* operator->() const { return m_vec; }
+		const T& operator[](const size_type& index) const { return (*m_vec)[index]; }
+
+		size_type size() const { return m_vec->size(); }
+		const_iterator begin() const { return m_vec->begin(); }
+		const_iterator end() const { return m_vec->end(); }
+
+		~snapshot() { if (m_reader) m_reader->unpin(); }
+		};
+
+	// a registered reading thread. it must only be used by one thread at a time, must not outlive its RcuVector
+	// and must not be moved while any of its snapshots are alive
+	class reader {
+	private:
+		RcuVector<T, MaxReaders> *m_owner;
+		size_type m_slot;
+		// snapshots of this reader that are alive, only the outermost one announces an epoch
+		unsigned m_pins;
+
+		friend class RcuVector<T, MaxReaders>;
+		friend class snapshot;
+		reader(RcuVector<T, MaxReaders> *owner, const size_type& slot) : m_owner(owner), m_slot(slot), m_pins(0) {}
+
+		void unpin();
+
+	public:
+		// snapshots point at the reader they came from, so the moved-from reader must have none alive (m_pins == 0)
+		reader(reader &&rdr) noexcept : m_owner(rdr.m_owner), m_slot(rdr.m_slot), m_pins(rdr.m_pins) { rdr.m_owner = nullptr; }
+		reader(const reader&) = delete;
+		reader& operator=(const reader&) = delete;
+
+		// wait-free: two atomic stores and two atomic loads
+		snapshot pin();
+
+		~reader();
+		};
+
+private:
+	// epoch announced by a reader slot when none of its snapshots are alive
+	static const std::uint64_t quiescent = 0;
+
+	// each slot on its own cache line, so that pinning never writes to a line that other readers touch
+	struct alignas(64) ReaderSlot {
+		std::atomic<std::uint64_t> epoch;
+		std::atomic<bool> used;
+		};
+
+	struct Retired {
+		const Vector<T> *vec;
+		std::uint64_t epoch;
+		};
+
+	std::atomic<const Vector<T>*> m_current;
+	std::atomic<std::uint64_t> m_epoch;
+	ReaderSlot m_slots[MaxReaders];
+
+	// serialises writers and guards the versions waiting to be deleted
+	mutable std::mutex m_writeLock;
+	Vector<Retired> m_retired;
+
+	void publishLocked(const Vector<T> *next);
+	void reclaimLocked();
+
+public:
+	//constructors
+	RcuVector();
+	explicit RcuVector(const Vector<T>& vec);
+	explicit RcuVector(Vector<T> &&vec);
+
+	// readers hold pointers into the RcuVector, so it cannot be copied or moved
+	RcuVector(const RcuVector<T, MaxReaders>&) = delete;
+	RcuVector<T, MaxReaders>& operator=(const RcuVector<T, MaxReaders>&) = delete;
+
+	// member functions
+
+	// claims a reader slot, throwing std::length_error when all MaxReaders slots are taken
+	reader register_reader();
+
+	// makes vec the current version. readers that pinned earlier keep the old one
+	void publish(Vector<T> &&vec);
+	void publish(const Vector<T>& vec);
+	// publishes a copy of the current version after fn has changed it
+	template<class Function> void update(Function fn);
+
+	// deletes the retired versions that no reader can still see, which publish also does
+	void reclaim();
+	// number of old versions waiting for readers to move on
+	size_type retired() const;
+
+	// no reader may be pinned when the RcuVector is destroyed
+	~RcuVector();
+	};
+
+// reader functions
+
+template<class T, std::size_t MaxReaders> typename RcuVector<T, MaxReaders>::snapshot RcuVector<T, MaxReaders>::reader::pin() {
+	if (m_pins++ == 0) {
+		// announce the epoch before loading the version. a writer that retires a version after this
+		// store either finds the announcement or retired it too late for this load to see it
+		m_owner->m_slots[m_slot].epoch.store(m_owner->m_epoch.load());
+		}
+	return snapshot(this, m_owner->m_current.load());
+	}
+
+template<class T, std::size_t MaxReaders> void RcuVector<T, MaxReaders>::reader::unpin() {
+	if (--m_pins == 0)
+		m_owner->m_slots[m_slot].epoch.store(quiescent, std::memory_order_release);
+	}
+
+template<class T, std::size_t MaxReaders> RcuVector<T, MaxReaders>::reader::~reader() {
+	if (m_owner)
+		m_owner->m_slots[m_slot].used.store(false, std::memory_order_release);
+	}
+
+// private functions
+
+template<class T, std::size_t MaxReaders> void RcuVector<T, MaxReaders>::publishLocked(const Vector<T> *next) {
+	// readers pinned in this epoch or earlier may hold the old version, readers that pin after the
+	// increment load the new one
+	const Retired old = { m_current.exchange(next), m_epoch.fetch_add(1) };
+	m_retired.push_back(old);
+	reclaimLocked();
+	}
+
+template<class T, std::size_t MaxReaders> void RcuVector<T, MaxReaders>::reclaimLocked() {
+	// the oldest epoch any reader is pinned in
+	std::uint64_t oldestPinned = m_epoch.load();
+	for (const ReaderSlot& slot : m_slots) {
+		const std::uint64_t epoch = slot.epoch.load();
+		if (epoch != quiescent && epoch < oldestPinned)
+			oldestPinned = epoch;
+		}
+
+	// keep the versions that were retired in or after that epoch
+	size_type kept = 0;
+	for (size_type index = 0; index != m_retired.size(); ++index) {
+		if (m_retired[index].epoch < oldestPinned)
+			delete m_retired[index].vec;
+		else
+			m_retired[kept++] = m_retired[index];
+		}
+	while (m_retired.size() != kept)
+		m_retired.pop_back();
+	}
+
+// constructors
+
+template<class T, std::size_t MaxReaders> RcuVector<T, MaxReaders>::RcuVector() : RcuVector(Vector<T>()) {}
+
+template<class T, std::size_t MaxReaders> RcuVector<T, MaxReaders>::RcuVector(const Vector<T>& vec) : RcuVector(Vector<T>(vec)) {}
+
+template<class T, std::size_t MaxReaders> RcuVector<T, MaxReaders>::RcuVector(Vector<T> &&vec) : m_current(new Vector<T>(std::move(vec))), m_epoch(1) {
+	for (ReaderSlot& slot : m_slots) {
+		slot.epoch.store(quiescent, std::memory_order_relaxed);
+		slot.used.store(false, std::memory_order_relaxed);
+		}
+	}
+
+// member functions
+
+template<class T, std::size_t MaxReaders> typename RcuVector<T, MaxReaders>::reader RcuVector<T, MaxReaders>::register_reader() {
+	for (size_type slot = 0; slot != MaxReaders; ++slot) {
+		bool used = false;
+		if (!m_slots[slot].used.load(std::memory_order_relaxed) && m_slots[slot].used.compare_exchange_strong(used, true, std::memory_order_acquire))
+			return reader(this, slot);
+		}
+	throw std::length_error("RcuVector has no free reader slot");
+	}
+
+template<class T, std::size_t MaxReaders> void RcuVector<T, MaxReaders>::publish(Vector<T> &&vec) {
+	// the new version is built before taking the lock so that other writers do not wait for it
+	const Vector<T> *next = new Vector<T>(std::move(vec));
+	std::lock_guard<std::mutex> lock(m_writeLock);
+	publishLocked(next);
+	}
+
+template<class T, std::size_t MaxReaders> void RcuVector<T, MaxReaders>::publish(const Vector<T>& vec) {
+	publish(Vector<T>(vec));
+	}
+
+template<class T, std::size_t MaxReaders> template<class Function> void RcuVector<T, MaxReaders>::update(Function fn) {
+	// holding the lock while fn runs stops a concurrent writer's version from being overwritten
+	std::lock_guard<std::mutex> lock(m_writeLock);
+	Vector<T> next = *m_current.load();
+	fn(next);
+	publishLocked(new Vector<T>(std::move(next)));
+	}
+
+template<class T, std::size_t MaxReaders> void RcuVector<T, MaxReaders>::reclaim() {
+	std::lock_guard<std::mutex> lock(m_writeLock);
+	reclaimLocked();
+	}
+
+template<class T, std::size_t MaxReaders> typename RcuVector<T, MaxReaders>::size_type RcuVector<T, MaxReaders>::retired() const {
+	std::lock_guard<std::mutex> lock(m_writeLock);
+	return m_retired.size();
+	}
+
+template<class T, std::size_t MaxReaders> RcuVector<T, MaxReaders>::~RcuVector() {
+	for (const Retired& old : m_retired)
+		delete old.vec;
+	delete m_current.load();
+	}
+
+#endif // !RCU_VECTOR_H
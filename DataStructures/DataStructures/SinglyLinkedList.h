@@ -2,6 +2,10 @@
 #define SINGLY_LINKED_LIST_H
 
 #include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include "Intrinsics.h"
 
 // forward declaration
 template<class T> class SinglyLinkedList;
@@ -30,7 +34,14 @@ private:
 	Node<T> *m_head;
 	size_type m_size;
 
+	// contiguous block of nodes created by compact(). its nodes are destroyed in place rather than deleted
+	Node<T> *m_slab;
+	size_type m_slabSize;
+	std::allocator<Node<T>> m_slabAlloc;
+
 	void uncreate();
+	void deleteNode(Node<T> *node);
+	void releaseSlab();
 
 public:
 
@@ -56,6 +67,11 @@ public:
 
 	SinglyLinkedList<T>& operator+=(const SinglyLinkedList<T>& rhs);
 
+	// move all nodes into a single allocation in list order, so that traversals read memory sequentially
+	void compact();
+	// average distance in bytes between the addresses of successive nodes (sizeof(Node<T>) when compact)
+	double fragmentation() const;
+
 	~SinglyLinkedList();
 
 
@@ -68,14 +84,35 @@ template<class T> inline void SinglyLinkedList<T>::uncreate() {
 	while (curNode != nullptr) {
 		delNode = curNode;
 		curNode = curNode->m_nextNode;
-		delete delNode;
+		// start loading the following node while this one is deleted
+		if (curNode != nullptr)
+			prefetch(curNode->m_nextNode);
+		deleteNode(delNode);
 		}
+	releaseSlab();
+	m_head = nullptr;
 	m_size = 0;
 	}
 
-template<class T> SinglyLinkedList<T>::SinglyLinkedList() : m_head(nullptr), m_size(size_type(0)) {}
+template<class T> inline void SinglyLinkedList<T>::deleteNode(Node<T> *node) {
+	std::less<const Node<T>*> before;
+	if (m_slab != nullptr && !before(node, m_slab) && before(node, m_slab + m_slabSize))
+		m_slabAlloc.destroy(node);
+	else
+		delete node;
+	}
+
+template<class T> inline void SinglyLinkedList<T>::releaseSlab() {
+	// the nodes in the slab must already have been destroyed
+	if (m_slab != nullptr)
+		m_slabAlloc.deallocate(m_slab, m_slabSize);
+	m_slab = nullptr;
+	m_slabSize = 0;
+	}
+
+template<class T> SinglyLinkedList<T>::SinglyLinkedList() : m_head(nullptr), m_size(size_type(0)), m_slab(nullptr), m_slabSize(0) {}
 
-template<class T> SinglyLinkedList<T>::SinglyLinkedList(const SinglyLinkedList<T>& sll) : m_size(size_type(0)) {
+template<class T> SinglyLinkedList<T>::SinglyLinkedList(const SinglyLinkedList<T>& sll) : m_head(nullptr), m_size(size_type(0)), m_slab(nullptr), m_slabSize(0) {
 	for (size_type index = 0; index != sll.m_size; ++index)
 		push_back(sll[index]);
 	}
@@ -84,12 +121,14 @@ template<class T> SinglyLinkedList<T>::SinglyLinkedList(SinglyLinkedList<T> &&sl
 	// steal members of sll
 	m_head = sll.m_head;
 	m_size = sll.m_size;
+	m_slab = sll.m_slab;
+	m_slabSize = sll.m_slabSize;
 	// leave sll in state where destructor can be called
-	sll.m_head = nullptr;
-	sll.m_size = 0;
+	sll.m_head = sll.m_slab = nullptr;
+	sll.m_size = sll.m_slabSize = 0;
 	}
 
-template<class T> SinglyLinkedList<T>::SinglyLinkedList(std::initializer_list<T> ls) {
+template<class T> SinglyLinkedList<T>::SinglyLinkedList(std::initializer_list<T> ls) : m_slab(nullptr), m_slabSize(0) {
 
 	auto iter = ls.begin();
 	m_head = new Node<T>(*iter++, nullptr);
@@ -151,12 +190,12 @@ template<class T> void SinglyLinkedList<T>::insert(T elem, const size_type& inde
 
 template<class T> void SinglyLinkedList<T>::remove(const size_type& index) {
 	if (index == 0 && m_head->m_nextNode == nullptr) {
-		delete m_head;
+		deleteNode(m_head);
 		m_head = nullptr;
 		}
 	else if (index == 0 && m_head->m_nextNode) {
 		Node<T> *tmp = m_head->m_nextNode;
-		delete m_head;
+		deleteNode(m_head);
 		m_head = tmp;
 		}
 	else {
@@ -167,7 +206,7 @@ template<class T> void SinglyLinkedList<T>::remove(const size_type& index) {
 			curNode = curNode->m_nextNode;
 			}
 		prevNode->m_nextNode = curNode->m_nextNode;
-		delete curNode;
+		deleteNode(curNode);
 		}
 	--m_size;
 	}
@@ -199,12 +238,15 @@ template<class T> SinglyLinkedList<T>& SinglyLinkedList<T>::operator=(const Sing
 
 template<class T> SinglyLinkedList<T>& SinglyLinkedList<T>::operator=(SinglyLinkedList<T> &&rhs) noexcept {
 	if (this != &rhs) {
+		uncreate();
 		// steal members of rhs
 		m_head = rhs.m_head;
 		m_size = rhs.m_size;
+		m_slab = rhs.m_slab;
+		m_slabSize = rhs.m_slabSize;
 		// leave rhs in a state where the destructor can be called
-		rhs.m_head = nullptr;
-		rhs.m_size = 0;
+		rhs.m_head = rhs.m_slab = nullptr;
+		rhs.m_size = rhs.m_slabSize = 0;
 		}
 	return *this;
 	}
@@ -216,6 +258,44 @@ template<class T> SinglyLinkedList<T>& SinglyLinkedList<T>::operator+=(const Sin
 	return *this;
 	}
 
+template<class T> void SinglyLinkedList<T>::compact() {
+	if (m_size == 0) {
+		releaseSlab();
+		return;
+		}
+
+	Node<T> *newSlab = m_slabAlloc.allocate(m_size);
+
+	// copy each node into the next slot of the new slab, freeing the old node as we go
+	Node<T> *curNode = m_head;
+	for (size_type index = 0; index != m_size; ++index) {
+		Node<T> *nextNode = curNode->m_nextNode;
+		if (nextNode != nullptr)
+			prefetch(nextNode->m_nextNode);
+		m_slabAlloc.construct(newSlab + index, curNode->m_data, index + 1 != m_size ? newSlab + index + 1 : nullptr);
+		deleteNode(curNode);
+		curNode = nextNode;
+		}
+
+	releaseSlab();
+	m_slab = newSlab;
+	m_slabSize = m_size;
+	m_head = newSlab;
+	}
+
+template<class T> double SinglyLinkedList<T>::fragmentation() const {
+	if (m_size < 2)
+		return 0.0;
+
+	double totalDistance = 0.0;
+	for (const Node<T> *curNode = m_head; curNode->m_nextNode != nullptr; curNode = curNode->m_nextNode) {
+		const std::uintptr_t from = reinterpret_cast<std::uintptr_t>(curNode);
+		const std::uintptr_t to = reinterpret_cast<std::uintptr_t>(curNode->m_nextNode);
+		totalDistance += double(from < to ? to - from : from - to);
+		}
+	return totalDistance / (m_size - 1);
+	}
+
 template<class T> SinglyLinkedList<T> operator+(const SinglyLinkedList<T>& lhs, const SinglyLinkedList<T>& rhs) {
 	SinglyLinkedList<T> tmp = lhs;
 	tmp += rhs;
@@ -20,6 +20,7 @@ private:
 
 	void uncreate();
 	void grow();
+	void reallocate(const size_type& capacity);
 
 public:
 	//constructors
@@ -43,6 +44,10 @@ public:
 	bool empty() const;
 	size_type size() const;
 	size_type reserved() const;
+	// allocate room for at least n elements, so that growing up to n elements does not reallocate
+	void reserve(const size_type& n);
+	// release the reserved memory
+	void shrink_to_fit();
 
 	iterator begin();
 	iterator end();
@@ -54,6 +59,8 @@ public:
 	const_iterator cend();
 
 	void push_back(const T& elem);
+	// destroys the last element, keeping its memory for the next push_back
+	void pop_back();
 	
 	//destructor
 	~Vector();
@@ -77,16 +84,19 @@ template<class T> inline void Vector<T>::uncreate() {
 
 template<class T> inline void Vector<T>::grow() {
 	// set allocated memory size to 1 if vector was previously empty or twice the current size
-	const Vector<T>::size_type newAllocMemorySize = std::max(2 * (m_memoryEnd - m_begin), std::ptrdiff_t(1));
+	reallocate(std::max(2 * (m_memoryEnd - m_begin), std::ptrdiff_t(1)));
+	}
+
+template<class T> inline void Vector<T>::reallocate(const size_type& capacity) {
 	// copy the elements into newly allocated memory
-	iterator newBegin = alloc.allocate(newAllocMemorySize);
-	iterator newEnd = std::uninitialized_copy(m_begin, m_end, newBegin); 
+	iterator newBegin = capacity ? alloc.allocate(capacity) : nullptr;
+	iterator newEnd = std::uninitialized_copy(m_begin, m_end, newBegin);
 	// unallocate the old memory
 	uncreate();
 	// set members to point to the new memory
 	m_begin = newBegin;
 	m_end = newEnd;
-	m_memoryEnd = m_begin + newAllocMemorySize;
+	m_memoryEnd = m_begin + capacity;
 	}
 
 // constructors
@@ -137,6 +147,8 @@ template<class T> Vector<T>& Vector<T>::operator=(const Vector<T>& rhs) {
 
 template<class T> Vector<T>& Vector<T>::operator=(Vector<T> &&rhs) noexcept {
 	if (this != &rhs) {
+		// release the memory currently held
+		uncreate();
 		// steal members from vector rhs
 		m_begin = rhs.m_begin;
 		m_end = rhs.m_end;
@@ -184,6 +196,16 @@ template<class T> typename Vector<T>::size_type Vector<T>::reserved() const {
 	return m_memoryEnd - m_end;
 	}
 
+template<class T> void Vector<T>::reserve(const size_type& n) {
+	if (n > size_type(m_memoryEnd - m_begin))
+		reallocate(n);
+	}
+
+template<class T> void Vector<T>::shrink_to_fit() {
+	if (m_memoryEnd != m_end)
+		reallocate(size());
+	}
+
 template<class T> typename Vector<T>::iterator Vector<T>::begin() {
 	return m_begin;
 	}
@@ -215,6 +237,10 @@ template<class T> void Vector<T>::push_back(const T& elem) {
 	alloc.construct(m_end++, elem);
 	}
 
+template<class T> void Vector<T>::pop_back() {
+	alloc.destroy(--m_end);
+	}
+
 template<class T> Vector<T>::~Vector() {
 	uncreate();
 	}
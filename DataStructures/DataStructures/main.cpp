@@ -1,18 +1,550 @@
 #include <iostream>
 #include <string>
 #include <cstdlib>
-#include <list>
+#include <chrono>
+#include <random>
+#include <set>
+#include <vector>
+#include <algorithm>
+#include <memory>
+#include <queue>
+#include "Vector.h"
+#include "FlatSet.h"
+#include "BitVector.h"
+#include "PackedIntVector.h"
+#include "DeltaVector.h"
 #include "SinglyLinkedList.h"
+#include "IntrusiveSList.h"
+#include "PagedVector.h"
+#include "RadixSort.h"
+#include "PriorityQueue.h"
+#include "RcuVector.h"
+#include <thread>
+#include <atomic>
+#include <shared_mutex>
 
-int main(int argc, char **argv) {
+// std::shared_mutex needs C++17 outside of MSVC, std::shared_timed_mutex is the C++14 equivalent
+#if defined(_MSC_VER) || __cplusplus >= 201703L
+typedef std::shared_mutex SharedMutex;
+#else
+typedef std::shared_timed_mutex SharedMutex;
+#endif
+
+// seconds taken by a single call of fn
+template<class Function> double timeSeconds(Function fn) {
+	const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	fn();
+	return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	}
+
+// lookup throughput of FlatSet against std::set and std::lower_bound on a sorted Vector
+void benchmarkFlatSet() {
+	typedef Vector<unsigned>::size_type size_type;
+	constexpr size_type queryCount = 1 << 20;
+
+	std::mt19937 gen(42);
+	std::cout << "FlatSet lookups (million per second)" << std::endl;
+	std::cout << "size\tstd::set\tVector\tSorted\tEytzinger\tEytzinger batched" << std::endl;
+
+	for (size_type n = 1 << 10; n <= size_type(1) << 22; n <<= 2) {
+		Vector<unsigned> elems;
+		std::set<unsigned> refSet;
+		for (size_type i = 0; i != n; ++i) {
+			const unsigned elem = unsigned(gen());
+			elems.push_back(elem);
+			refSet.insert(elem);
+			}
+		// half of the queries hit
+		Vector<unsigned> queries;
+		for (size_type i = 0; i != queryCount; ++i)
+			queries.push_back(i & 1 ? elems[gen() % n] : unsigned(gen()));
+
+		Vector<unsigned> sortedVec = elems;
+		std::sort(sortedVec.begin(), sortedVec.end());
+		const FlatSet<unsigned> sortedSet(elems);
+		const FlatSet<unsigned> eytzingerSet(elems, SearchLayout::Eytzinger);
+
+		// accumulate the results so that the lookups are not optimised away
+		size_type found = 0;
+		const double setTime = timeSeconds([&]() {
+			for (const unsigned& query : queries)
+				found += refSet.count(query);
+			});
+		const double vecTime = timeSeconds([&]() {
+			for (const unsigned& query : queries) {
+				const unsigned *iter = std::lower_bound(sortedVec.cbegin(), sortedVec.cend(), query);
+				found += iter != sortedVec.cend() && *iter == query;
+				}
+			});
+		const double sortedTime = timeSeconds([&]() {
+			for (const unsigned& query : queries)
+				found += sortedSet.count(query);
+			});
+		const double eytzingerTime = timeSeconds([&]() {
+			for (const unsigned& query : queries)
+				found += eytzingerSet.count(query);
+			});
+		Vector<size_type> slots(queryCount);
+		const double batchTime = timeSeconds([&]() {
+			eytzingerSet.find_slots(queries.begin(), queries.end(), slots.begin());
+			});
+		for (const size_type& slot : slots)
+			found += slot != FlatSet<unsigned>::npos;
+
+		const double millions = queryCount / 1e6;
+		std::cout << n << '\t' << millions / setTime << '\t' << millions / vecTime << '\t' << millions / sortedTime
+			<< '\t' << millions / eytzingerTime << '\t' << millions / batchTime << "\t(" << found << ')' << std::endl;
+		}
+	}
+
+// memory footprint and access throughput of the compact integer vectors against plain Vectors
+void benchmarkCompactVectors() {
+	typedef Vector<std::uint32_t>::size_type size_type;
+	constexpr size_type n = 1 << 24;
+	constexpr std::uint32_t idBits = 20;
+
+	std::mt19937 gen(42);
+	Vector<std::uint32_t> ids;
+	Vector<bool> flags;
+	Vector<std::uint32_t> sortedIds;
+	PackedIntVector<idBits> packedIds;
+	BitVector bitFlags;
+	DeltaVector deltaIds;
+	// reserve up front so that the footprints below are not rounded up by growth
+	ids.reserve(n);
+	flags.reserve(n);
+	sortedIds.reserve(n);
+	packedIds.reserve(n);
+
+	std::uint32_t sortedId = 0;
+	for (size_type i = 0; i != n; ++i) {
+		const std::uint32_t id = gen() & ((1u << idBits) - 1);
+		const bool flag = (gen() & 3) == 0;
+		sortedId += gen() % 64;
+		ids.push_back(id);
+		packedIds.push_back(id);
+		flags.push_back(flag);
+		bitFlags.push_back(flag);
+		sortedIds.push_back(sortedId);
+		deltaIds.push_back(sortedId);
+		}
+	deltaIds.shrink_to_fit();
+
+	Vector<size_type> positions;
+	for (size_type i = 0; i != n; ++i)
+		positions.push_back(gen() % n);
+
+	// accumulate the results so that the reads are not optimised away
+	std::uint64_t sum = 0;
+	const double millions = n / 1e6;
+	const double mib = 1024.0 * 1024.0;
+
+	std::cout << "compact vectors of " << n << " elements" << std::endl;
+	std::cout << "container\tMiB\tsequential M/s\trandom M/s" << std::endl;
+
+	const double idsSeq = timeSeconds([&]() { for (const std::uint32_t& id : ids) sum += id; });
+	const double idsRand = timeSeconds([&]() { for (const size_type& pos : positions) sum += ids[pos]; });
+	std::cout << "Vector<uint32_t>\t" << (ids.size() + ids.reserved()) * sizeof(std::uint32_t) / mib
+		<< '\t' << millions / idsSeq << '\t' << millions / idsRand << std::endl;
+
+	const double packedSeq = timeSeconds([&]() { for (std::uint32_t id : packedIds) sum += id; });
+	const double packedRand = timeSeconds([&]() {
+		const PackedIntVector<idBits>& constPackedIds = packedIds;
+		for (const size_type& pos : positions) sum += constPackedIds[pos];
+		});
+	std::cout << "PackedIntVector<" << idBits << ">\t" << packedIds.memory_bytes() / mib
+		<< '\t' << millions / packedSeq << '\t' << millions / packedRand << std::endl;
+
+	const double flagsSeq = timeSeconds([&]() { for (const bool& flag : flags) sum += flag; });
+	const double flagsRand = timeSeconds([&]() { for (const size_type& pos : positions) sum += flags[pos]; });
+	std::cout << "Vector<bool>\t" << (flags.size() + flags.reserved()) * sizeof(bool) / mib
+		<< '\t' << millions / flagsSeq << '\t' << millions / flagsRand << std::endl;
+
+	const double bitsSeq = timeSeconds([&]() { for (bool flag : bitFlags) sum += flag; });
+	const double bitsRank = timeSeconds([&]() { for (const size_type& pos : positions) sum += bitFlags.rank(pos); });
+	std::cout << "BitVector (random = rank)\t" << bitFlags.memory_bytes() / mib
+		<< '\t' << millions / bitsSeq << '\t' << millions / bitsRank << std::endl;
+
+	const double sortedSeq = timeSeconds([&]() { for (const std::uint32_t& id : sortedIds) sum += id; });
+	const double sortedRand = timeSeconds([&]() { for (const size_type& pos : positions) sum += sortedIds[pos]; });
+	std::cout << "sorted Vector<uint32_t>\t" << (sortedIds.size() + sortedIds.reserved()) * sizeof(std::uint32_t) / mib
+		<< '\t' << millions / sortedSeq << '\t' << millions / sortedRand << std::endl;
+
+	const double deltaSeq = timeSeconds([&]() { for (DeltaVector::const_iterator iter = deltaIds.begin(); iter != deltaIds.end(); ++iter) sum += *iter; });
+	const double deltaRand = timeSeconds([&]() { for (const size_type& pos : positions) sum += deltaIds[pos]; });
+	std::cout << "DeltaVector\t" << deltaIds.memory_bytes() / mib
+		<< '\t' << millions / deltaSeq << '\t' << millions / deltaRand << std::endl;
+
+	std::cout << "(" << sum << ")" << std::endl;
+	}
+
+struct BenchmarkTimer {
+	std::uint64_t deadline;
+	SListHook hook;
+	};
+
+// moving timer objects between two lists: IntrusiveSList against SinglyLinkedList
+void benchmarkIntrusiveSList() {
+	typedef Vector<BenchmarkTimer>::size_type size_type;
+	constexpr size_type timerCount = 1 << 12;
+	constexpr size_type moveCount = 1 << 24;
+
+	Vector<BenchmarkTimer> timers(timerCount);
+	IntrusiveSList<BenchmarkTimer, &BenchmarkTimer::hook> intrusiveLists[2];
+	SinglyLinkedList<BenchmarkTimer> ownedLists[2];
+	for (BenchmarkTimer& timer : timers) {
+		intrusiveLists[0].push_front(timer);
+		ownedLists[0].push_front(timer);
+		}
+
+	// accumulate the deadlines so that the moves are not optimised away
+	std::uint64_t sum = 0;
+	const double intrusiveTime = timeSeconds([&]() {
+		for (size_type i = 0; i != moveCount; ++i) {
+			IntrusiveSList<BenchmarkTimer, &BenchmarkTimer::hook>& from = intrusiveLists[(i / timerCount) & 1];
+			BenchmarkTimer& timer = from.front();
+			from.pop_front();
+			sum += timer.deadline++;
+			intrusiveLists[~(i / timerCount) & 1].push_front(timer);
+			}
+		});
+	const double ownedTime = timeSeconds([&]() {
+		for (size_type i = 0; i != moveCount; ++i) {
+			SinglyLinkedList<BenchmarkTimer>& from = ownedLists[(i / timerCount) & 1];
+			BenchmarkTimer timer = from[0];
+			from.remove(0);
+			sum += timer.deadline++;
+			ownedLists[~(i / timerCount) & 1].push_front(timer);
+			}
+		});
+
+	const double millions = moveCount / 1e6;
+	std::cout << "list moves (million per second)" << std::endl;
+	std::cout << "IntrusiveSList\t" << millions / intrusiveTime << std::endl;
+	std::cout << "SinglyLinkedList\t" << millions / ownedTime << "\t(" << sum << ')' << std::endl;
+	}
+
+// traversal of a deliberately fragmented SinglyLinkedList before and after compact()
+void benchmarkListCompaction() {
+	typedef SinglyLinkedList<std::uint64_t>::size_type size_type;
+	constexpr size_type n = 1 << 20;
+	constexpr size_type traversals = 20;
+
+	// fill the heap with blocks of random size and free a random half of them,
+	// so that the list nodes land in scattered holes
+	std::mt19937 gen(42);
+	std::vector<std::unique_ptr<char[]>> spacers;
+	for (size_type i = 0; i != 2 * n; ++i)
+		spacers.emplace_back(new char[16 + gen() % 256]);
+	std::shuffle(spacers.begin(), spacers.end(), gen);
+	for (size_type i = 0; i != n; ++i)
+		spacers[i].reset();
+
+	SinglyLinkedList<std::uint64_t> list;
+	for (size_type i = 0; i != n; ++i)
+		list.push_front(i);
+
+	// operator[] on the last element walks the whole list
+	std::uint64_t sum = 0;
+	const double fragmentedDistance = list.fragmentation();
+	const double fragmentedTime = timeSeconds([&]() {
+		for (size_type i = 0; i != traversals; ++i)
+			sum += list[n - 1];
+		});
+
+	list.compact();
 
-	const SINGLY_LINKED_LIST_H::SinglyLinkedList<int> ccRefList{ 1,2,3,4,5 };
+	const double compactDistance = list.fragmentation();
+	const double compactTime = timeSeconds([&]() {
+		for (size_type i = 0; i != traversals; ++i)
+			sum += list[n - 1];
+		});
 
-	SINGLY_LINKED_LIST_H::SinglyLinkedList<int> ccTestList(ccRefList);
+	const double millions = n * traversals / 1e6;
+	std::cout << "SinglyLinkedList traversal of " << n << " nodes" << std::endl;
+	std::cout << "fragmented\t" << fragmentedDistance << " bytes between nodes\t" << millions / fragmentedTime << " M nodes/s" << std::endl;
+	std::cout << "compacted\t" << compactDistance << " bytes between nodes\t" << millions / compactTime << " M nodes/s\t(" << sum << ')' << std::endl;
+	}
+
+// a 1% populated id space: PagedVector against a Vector filled up front
+void benchmarkPagedVector() {
+	typedef Vector<std::uint32_t>::size_type size_type;
+	constexpr size_type n = size_type(1) << 26;
+	// ids are populated in runs, as they are handed out in batches
+	constexpr size_type runLength = 256;
+	constexpr size_type runs = n / 100 / runLength;
+
+	std::mt19937 gen(42);
+	Vector<size_type> runStarts;
+	for (size_type i = 0; i != runs; ++i)
+		runStarts.push_back(gen() % (n / runLength) * runLength);
+
+	// accumulate the results so that the work is not optimised away
+	std::uint64_t sum = 0;
+	const double mib = 1024.0 * 1024.0;
+
+	Vector<std::uint32_t> *vec = nullptr;
+	const double vecBuildTime = timeSeconds([&]() {
+		vec = new Vector<std::uint32_t>(n, 0);
+		for (const size_type& start : runStarts)
+			for (size_type id = start; id != start + runLength; ++id)
+				(*vec)[id] = std::uint32_t(id);
+		});
+	const double vecScanTime = timeSeconds([&]() {
+		for (const std::uint32_t& elem : *vec)
+			sum += elem;
+		});
+	const size_type vecBytes = (vec->size() + vec->reserved()) * sizeof(std::uint32_t);
+	delete vec;
+
+	PagedVector<std::uint32_t> *paged = nullptr;
+	const double pagedBuildTime = timeSeconds([&]() {
+		paged = new PagedVector<std::uint32_t>(n);
+		for (const size_type& start : runStarts)
+			for (size_type id = start; id != start + runLength; ++id)
+				(*paged)[id] = std::uint32_t(id);
+		});
+	const double pagedScanTime = timeSeconds([&]() {
+		for (PagedVector<std::uint32_t>::const_iterator iter = paged->populated_begin(); iter != paged->populated_end(); ++iter)
+			sum += *iter;
+		});
+	const size_type pagedBytes = paged->memory_bytes();
+	delete paged;
+
+	std::cout << "1% populated id space of " << n << " elements" << std::endl;
+	std::cout << "container\tMiB\tbuild s\tscan s" << std::endl;
+	std::cout << "Vector\t" << vecBytes / mib << '\t' << vecBuildTime << '\t' << vecScanTime << std::endl;
+	std::cout << "PagedVector\t" << pagedBytes / mib << '\t' << pagedBuildTime << '\t' << pagedScanTime << "\t(" << sum << ')' << std::endl;
+	}
+
+// radix sort against std::sort on integer keys and on records sorted by a key
+void benchmarkRadixSort() {
+	typedef Vector<std::uint64_t>::size_type size_type;
+	typedef std::pair<std::uint32_t, std::uint32_t> Record;
+	// raise to 1000000000 on a machine with enough memory
+	constexpr size_type maxElements = 10000000;
+
+	const unsigned threads = std::max(std::thread::hardware_concurrency(), 1u);
+	RadixSorter<std::uint64_t> sorter;
+	RadixSorter<std::uint64_t> threadedSorter(threads);
+	RadixSorter<Record> recordSorter;
+	std::mt19937_64 gen(42);
+
+	std::cout << "sorting (million elements per second), " << threads << " threads" << std::endl;
+	std::cout << "size\tstd::sort\tLSD\tMSD\tLSD threaded\trecords std::sort\trecords LSD" << std::endl;
+
+	for (size_type n = 10000; n <= maxElements; n *= 10) {
+		Vector<std::uint64_t> keys;
+		Vector<Record> records;
+		for (size_type i = 0; i != n; ++i) {
+			keys.push_back(gen());
+			records.push_back(Record(std::uint32_t(gen()), std::uint32_t(i)));
+			}
+
+		Vector<std::uint64_t> work = keys;
+		const double stdTime = timeSeconds([&]() { std::sort(work.begin(), work.end()); });
+		work = keys;
+		const double lsdTime = timeSeconds([&]() { sorter.sort(work); });
+		work = keys;
+		const double msdTime = timeSeconds([&]() { sorter.sort_msd(work); });
+		work = keys;
+		const double threadedTime = timeSeconds([&]() { threadedSorter.sort(work); });
+
+		Vector<Record> recordWork = records;
+		const double recordStdTime = timeSeconds([&]() {
+			std::sort(recordWork.begin(), recordWork.end(), [](const Record& lhs, const Record& rhs) { return lhs.first < rhs.first; });
+			});
+		recordWork = records;
+		const double recordLsdTime = timeSeconds([&]() {
+			recordSorter.sort(recordWork, [](const Record& record) { return record.first; });
+			});
+
+		const double millions = n / 1e6;
+		std::cout << n << '\t' << millions / stdTime << '\t' << millions / lsdTime << '\t' << millions / msdTime
+			<< '\t' << millions / threadedTime << '\t' << millions / recordStdTime << '\t' << millions / recordLsdTime << std::endl;
+		}
+	}
+
+// timer workloads of PriorityQueue against std::priority_queue. in the hold model the earliest timer fires and is
+// rearmed; in the reschedule model most steps push back the deadline of a pending timer instead, which
+// std::priority_queue can only do by pushing a new entry and skipping the stale one when it reaches the top
+void benchmarkPriorityQueue() {
+	typedef Vector<std::uint64_t>::size_type size_type;
+	typedef std::pair<std::uint64_t, size_type> Entry;
+	constexpr size_type stepCount = 1 << 22;
+
+	std::mt19937_64 gen(42);
+	std::uniform_int_distribution<std::uint64_t> delay(1, 1 << 20);
+	std::cout << "timer queues (million operations per second)" << std::endl;
+	std::cout << "timers\thold std\thold 2-ary\thold 4-ary\thold 8-ary\treschedule std\treschedule 4-ary tracked" << std::endl;
+
+	for (size_type n = 1 << 10; n <= size_type(1) << 20; n <<= 5) {
+		Vector<std::uint64_t> deadlines;
+		for (size_type i = 0; i != n; ++i)
+			deadlines.push_back(delay(gen));
+		Vector<std::uint64_t> delays;
+		for (size_type i = 0; i != stepCount; ++i)
+			delays.push_back(delay(gen));
+
+		std::priority_queue<std::uint64_t, std::vector<std::uint64_t>, std::greater<std::uint64_t>> stdQueue(deadlines.begin(), deadlines.end());
+		const double holdStdTime = timeSeconds([&]() {
+			for (size_type step = 0; step != stepCount; ++step) {
+				const std::uint64_t now = stdQueue.top();
+				stdQueue.pop();
+				stdQueue.push(now + delays[step]);
+				}
+			});
+
+		// the same hold loop for each arity
+		auto hold = [&](auto& queue) {
+			return timeSeconds([&]() {
+				for (size_type step = 0; step != stepCount; ++step) {
+					const std::uint64_t now = queue.top();
+					queue.pop();
+					queue.push(now + delays[step]);
+					}
+				});
+			};
+		PriorityQueue<std::uint64_t, std::greater<std::uint64_t>, 2> binaryQueue(deadlines);
+		PriorityQueue<std::uint64_t, std::greater<std::uint64_t>, 4> quaternaryQueue(deadlines);
+		PriorityQueue<std::uint64_t, std::greater<std::uint64_t>, 8> octonaryQueue(deadlines);
+		const double hold2Time = hold(binaryQueue);
+		const double hold4Time = hold(quaternaryQueue);
+		const double hold8Time = hold(octonaryQueue);
+
+		// reschedule: three of every four steps push back the deadline of a random timer
+		std::uniform_int_distribution<size_type> timer(0, n - 1);
+		Vector<size_type> targets;
+		for (size_type i = 0; i != stepCount; ++i)
+			targets.push_back(timer(gen));
+
+		Vector<std::uint64_t> current = deadlines;
+		std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> lazyQueue;
+		for (size_type i = 0; i != n; ++i)
+			lazyQueue.push(Entry(deadlines[i], i));
+		const double rescheduleStdTime = timeSeconds([&]() {
+			for (size_type step = 0; step != stepCount; ++step) {
+				if (step % 4 != 0) {
+					current[targets[step]] += delays[step];
+					lazyQueue.push(Entry(current[targets[step]], targets[step]));
+					continue;
+					}
+				while (lazyQueue.top().first != current[lazyQueue.top().second])
+					lazyQueue.pop();
+				const Entry fired = lazyQueue.top();
+				lazyQueue.pop();
+				current[fired.second] = fired.first + delays[step];
+				lazyQueue.push(Entry(current[fired.second], fired.second));
+				}
+			});
+
+		// handle i belongs to timer i, and a rearmed timer keeps its handle because it is pushed right after the pop
+		PriorityQueue<std::uint64_t, std::greater<std::uint64_t>, 4, true> trackedQueue(deadlines);
+		const double rescheduleTrackedTime = timeSeconds([&]() {
+			for (size_type step = 0; step != stepCount; ++step) {
+				if (step % 4 != 0) {
+					trackedQueue.update(targets[step], trackedQueue.get(targets[step]) + delays[step]);
+					continue;
+					}
+				const std::uint64_t now = trackedQueue.top();
+				trackedQueue.pop();
+				trackedQueue.push(now + delays[step]);
+				}
+			});
+
+		const double millions = stepCount / 1e6;
+		std::cout << n << '\t' << millions / holdStdTime << '\t' << millions / hold2Time << '\t' << millions / hold4Time
+			<< '\t' << millions / hold8Time << '\t' << millions / rescheduleStdTime << '\t' << millions / rescheduleTrackedTime << std::endl;
+		}
+	}
+
+// read throughput of RcuVector against a Vector behind a shared mutex, while a writer replaces the table every millisecond
+void benchmarkRcuVector() {
+	typedef Vector<unsigned>::size_type size_type;
+	constexpr size_type tableSize = 1 << 12;
+	constexpr size_type readsPerThread = 1 << 18;
+	constexpr size_type lookupsPerRead = 4;
+
+	std::cout << "concurrent table reads (million per second), " << std::thread::hardware_concurrency() << " hardware threads" << std::endl;
+	std::cout << "threads\tshared mutex\tRcuVector\tversions published" << std::endl;
+
+	for (unsigned threadCount = 1; threadCount <= 64; threadCount *= 2) {
+		// runs body on threadCount reader threads while replacing the table through publish, returning the reading time
+		auto run = [&](auto body, auto publish, size_type& published) {
+			std::atomic<unsigned> finished(0);
+			std::vector<std::thread> readers;
+			return timeSeconds([&]() {
+				for (unsigned thread = 0; thread != threadCount; ++thread) {
+					readers.emplace_back([&, thread]() {
+						body(thread);
+						++finished;
+						});
+					}
+				for (unsigned version = 1; finished.load() != threadCount; ++version) {
+					publish(version);
+					++published;
+					std::this_thread::sleep_for(std::chrono::milliseconds(1));
+					}
+				for (std::thread& reader : readers)
+					reader.join();
+				});
+			};
+
+		// shared mutex
+		Vector<unsigned> lockedTable(tableSize, 0);
+		SharedMutex tableMutex;
+		std::atomic<unsigned> lockedSum(0);
+		size_type lockedPublished = 0;
+		const double lockedTime = run([&](unsigned thread) {
+			std::minstd_rand gen(thread + 1);
+			unsigned sum = 0;
+			for (size_type read = 0; read != readsPerThread; ++read) {
+				std::shared_lock<SharedMutex> lock(tableMutex);
+				for (size_type lookup = 0; lookup != lookupsPerRead; ++lookup)
+					sum += lockedTable[gen() % tableSize];
+				}
+			lockedSum += sum;
+			}, [&](unsigned version) {
+			Vector<unsigned> next(tableSize, version);
+			std::unique_lock<SharedMutex> lock(tableMutex);
+			lockedTable = std::move(next);
+			}, lockedPublished);
+
+		// RcuVector
+		RcuVector<unsigned> rcuTable(Vector<unsigned>(tableSize, 0));
+		std::atomic<unsigned> rcuSum(0);
+		size_type rcuPublished = 0;
+		const double rcuTime = run([&](unsigned thread) {
+			RcuVector<unsigned>::reader reader = rcuTable.register_reader();
+			std::minstd_rand gen(thread + 1);
+			unsigned sum = 0;
+			for (size_type read = 0; read != readsPerThread; ++read) {
+				RcuVector<unsigned>::snapshot table = reader.pin();
+				for (size_type lookup = 0; lookup != lookupsPerRead; ++lookup)
+					sum += table[gen() % tableSize];
+				}
+			rcuSum += sum;
+			}, [&](unsigned version) {
+			rcuTable.publish(Vector<unsigned>(tableSize, version));
+			}, rcuPublished);
+
+		const double millions = threadCount * readsPerThread / 1e6;
+		std::cout << threadCount << '\t' << millions / lockedTime << '\t' << millions / rcuTime << '\t'
+			<< lockedPublished << '/' << rcuPublished << std::endl;
+		}
+	}
+
+int main(int argc, char **argv) {
 
-	for (SINGLY_LINKED_LIST_H::SinglyLinkedList<int>::size_type index = 0; index != ccRefList.size(); ++index)
-		std::cout << ccRefList[index] << "|" << ccTestList[index] << std::endl;
+	benchmarkFlatSet();
+	benchmarkCompactVectors();
+	benchmarkIntrusiveSList();
+	benchmarkListCompaction();
+	benchmarkPagedVector();
+	benchmarkRadixSort();
+	benchmarkPriorityQueue();
+	benchmarkRcuVector();
 
 	system("pause");
 	return EXIT_SUCCESS;
-	}
\ No newline at end of file
+	}
@@ -4,6 +4,23 @@
 #include <vector>
 #include "..\DataStructures\SinglyLinkedList.h"
 #include <list>
+#include "..\DataStructures\FlatSet.h"
+#include "..\DataStructures\FlatMap.h"
+#include <set>
+#include <map>
+#include "..\DataStructures\BitVector.h"
+#include "..\DataStructures\PackedIntVector.h"
+#include "..\DataStructures\DeltaVector.h"
+#include "..\DataStructures\IntrusiveSList.h"
+#include "..\DataStructures\PagedVector.h"
+#include "..\DataStructures\RadixSort.h"
+#include "..\DataStructures\PriorityQueue.h"
+#include <queue>
+#include "..\DataStructures\RcuVector.h"
+#include <thread>
+#include <atomic>
+#include <algorithm>
+#include <limits>
 #include <iostream>
 
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
@@ -168,6 +185,22 @@ namespace DataStructuresTest
 			Assert::AreNotEqual(testVec.begin(), testVec.end());
 			Assert::AreNotEqual(testVec.cbegin(), testVec.cend());
 
+			// pop_back keeps the memory of the removed element
+			testVec.pop_back();
+			Assert::AreEqual(VECTOR_H::Vector<int>::size_type(2), testVec.size());
+			Assert::AreEqual(VECTOR_H::Vector<int>::size_type(2), testVec.reserved());
+			Assert::AreEqual(2, testVec[1]);
+
+			// reserve only ever grows the memory, shrink_to_fit releases what is not used
+			testVec.reserve(10);
+			Assert::AreEqual(VECTOR_H::Vector<int>::size_type(8), testVec.reserved());
+			testVec.reserve(4);
+			Assert::AreEqual(VECTOR_H::Vector<int>::size_type(8), testVec.reserved());
+			testVec.shrink_to_fit();
+			Assert::AreEqual(VECTOR_H::Vector<int>::size_type(0), testVec.reserved());
+			Assert::AreEqual(1, testVec[0]);
+			Assert::AreEqual(2, testVec[1]);
+
 			}
 
 		};
@@ -326,5 +359,802 @@ namespace DataStructuresTest
 
 			}
 
+		TEST_METHOD(CompactTest) {
+			SINGLY_LINKED_LIST_H::SinglyLinkedList<int> refList{ 0,1,2,3,4,5,6,7 };
+			SINGLY_LINKED_LIST_H::SinglyLinkedList<int> testList{ 9,0,1,3,4,5,6 };
+
+			testList.remove(0);
+			testList.insert(2, 2);
+			testList.push_back(7);
+
+			testList.compact();
+
+			// nodes are adjacent and in list order after compaction
+			Assert::AreEqual(double(sizeof(SINGLY_LINKED_LIST_H::Node<int>)), testList.fragmentation());
+			for (SINGLY_LINKED_LIST_H::SinglyLinkedList<int>::size_type index = 0; index != refList.size(); ++index)
+				Assert::AreEqual(refList[index], testList[index]);
+
+			// the list stays usable after compaction, mixing slab and heap nodes
+			testList.remove(3);
+			testList.insert(3, 3);
+			testList.remove(0);
+			testList.push_front(0);
+
+			for (SINGLY_LINKED_LIST_H::SinglyLinkedList<int>::size_type index = 0; index != refList.size(); ++index)
+				Assert::AreEqual(refList[index], testList[index]);
+
+			testList.compact();
+			testList.compact();
+
+			for (SINGLY_LINKED_LIST_H::SinglyLinkedList<int>::size_type index = 0; index != refList.size(); ++index)
+				Assert::AreEqual(refList[index], testList[index]);
+
+			SINGLY_LINKED_LIST_H::SinglyLinkedList<int> moveTestList = std::move(testList);
+			Assert::AreEqual(refList.size(), moveTestList.size());
+
+			while (!moveTestList.empty())
+				moveTestList.remove(0);
+			moveTestList.compact();
+			Assert::AreEqual(0.0, moveTestList.fragmentation());
+			}
+
+		};
+
+	TEST_CLASS(FlatSetUnitTest) {
+
+		TEST_METHOD(ConstructorTest) {
+			// bulk build sorts and removes duplicates
+			std::set<int> refSet{ 5,3,9,1,3,7,5,0 };
+
+			FLAT_SET_H::FlatSet<int> sortedTestSet{ 5,3,9,1,3,7,5,0 };
+			FLAT_SET_H::FlatSet<int> eytzingerTestSet({ 5,3,9,1,3,7,5,0 }, SearchLayout::Eytzinger);
+
+			Assert::AreEqual(refSet.size(), sortedTestSet.size());
+			Assert::AreEqual(refSet.size(), eytzingerTestSet.size());
+
+			// iteration is in ascending order for both layouts
+			std::set<int>::const_iterator refIter = refSet.begin();
+			for (FLAT_SET_H::FlatSet<int>::const_iterator iter = sortedTestSet.begin(); iter != sortedTestSet.end(); ++iter)
+				Assert::AreEqual(*refIter++, *iter);
+
+			refIter = refSet.begin();
+			for (const int& elem : eytzingerTestSet)
+				Assert::AreEqual(*refIter++, elem);
+
+			// vector constructor
+			VECTOR_H::Vector<int> elems{ 4,4,2,8 };
+			FLAT_SET_H::FlatSet<int> vecTestSet(elems);
+			Assert::AreEqual(FLAT_SET_H::FlatSet<int>::size_type(3), vecTestSet.size());
+
+			FLAT_SET_H::FlatSet<int> emptyTestSet(SearchLayout::Eytzinger);
+			Assert::IsTrue(emptyTestSet.empty());
+			Assert::IsTrue(emptyTestSet.begin() == emptyTestSet.end());
+			Assert::IsFalse(emptyTestSet.contains(0));
+			}
+
+		TEST_METHOD(LookupTest) {
+			// compare every layout against the reference implementation for a range of sizes
+			const SearchLayout layouts[] = { SearchLayout::Sorted, SearchLayout::Eytzinger };
+
+			for (SearchLayout layout : layouts) {
+				for (int n = 0; n != 70; ++n) {
+					std::set<int> refSet;
+					VECTOR_H::Vector<int> elems;
+					for (int i = 0; i != n; ++i) {
+						refSet.insert(3 * i);
+						elems.push_back(3 * (n - 1 - i));
+						}
+
+					FLAT_SET_H::FlatSet<int> testSet(elems, layout);
+
+					VECTOR_H::Vector<int> queries;
+					for (int query = -2; query <= 3 * n + 1; ++query)
+						queries.push_back(query);
+
+					VECTOR_H::Vector<bool> batchFound = testSet.contains_batch(queries);
+
+					for (VECTOR_H::Vector<int>::size_type index = 0; index != queries.size(); ++index) {
+						const int query = queries[index];
+						const bool refFound = refSet.count(query) != 0;
+
+						Assert::AreEqual(refFound, testSet.contains(query));
+						Assert::AreEqual(refFound, batchFound[index]);
+
+						std::set<int>::const_iterator refLower = refSet.lower_bound(query);
+						FLAT_SET_H::FlatSet<int>::const_iterator testLower = testSet.lower_bound(query);
+						if (refLower == refSet.end())
+							Assert::IsTrue(testLower == testSet.end());
+						else
+							Assert::AreEqual(*refLower, *testLower);
+						}
+					}
+				}
+			}
+
+		};
+
+	TEST_CLASS(FlatMapUnitTest) {
+
+		TEST_METHOD(ConstructorTest) {
+			// the first entry of a duplicate key is kept
+			std::map<int, char> refMap{ { 3,'c' },{ 1,'a' },{ 2,'b' } };
+
+			FLAT_MAP_H::FlatMap<int, char> sortedTestMap{ { 3,'c' },{ 1,'a' },{ 3,'x' },{ 2,'b' } };
+			FLAT_MAP_H::FlatMap<int, char> eytzingerTestMap({ { 3,'c' },{ 1,'a' },{ 3,'x' },{ 2,'b' } }, SearchLayout::Eytzinger);
+
+			Assert::AreEqual(refMap.size(), sortedTestMap.size());
+			Assert::AreEqual(refMap.size(), eytzingerTestMap.size());
+
+			std::map<int, char>::const_iterator refIter = refMap.begin();
+			for (FLAT_MAP_H::FlatMap<int, char>::const_iterator iter = eytzingerTestMap.begin(); iter != eytzingerTestMap.end(); ++iter, ++refIter) {
+				Assert::AreEqual(refIter->first, iter.key());
+				Assert::AreEqual(refIter->second, iter.value());
+				}
+
+			refIter = refMap.begin();
+			for (auto entry : sortedTestMap) {
+				Assert::AreEqual(refIter->first, entry.first);
+				Assert::AreEqual(refIter->second, entry.second);
+				++refIter;
+				}
+			}
+
+		TEST_METHOD(LookupTest) {
+			VECTOR_H::Vector<std::pair<int, int>> elems;
+			for (int i = 0; i != 100; ++i)
+				elems.push_back(std::pair<int, int>(2 * i, i));
+
+			FLAT_MAP_H::FlatMap<int, int> testMap(elems, SearchLayout::Eytzinger);
+
+			VECTOR_H::Vector<int> queries;
+			for (int query = -1; query != 201; ++query)
+				queries.push_back(query);
+
+			VECTOR_H::Vector<const int*> batchValues(queries.size());
+			testMap.find_batch(queries.begin(), queries.end(), batchValues.begin());
+
+			for (VECTOR_H::Vector<int>::size_type index = 0; index != queries.size(); ++index) {
+				const int query = queries[index];
+				const int *value = testMap.find(query);
+				if (query >= 0 && query < 200 && query % 2 == 0) {
+					Assert::IsTrue(value != nullptr);
+					Assert::AreEqual(query / 2, *value);
+					Assert::IsTrue(value == batchValues[index]);
+					}
+				else {
+					Assert::IsTrue(value == nullptr);
+					Assert::IsTrue(batchValues[index] == nullptr);
+					}
+				}
+
+			// values can be updated in place
+			*testMap.find(10) = -1;
+			Assert::AreEqual(-1, *testMap.find(10));
+			}
+
+		};
+
+	TEST_CLASS(BitVectorUnitTest) {
+
+		TEST_METHOD(ConstructorTest) {
+			std::vector<bool> refVec{ true,false,false,true,true };
+			BIT_VECTOR_H::BitVector testVec{ true,false,false,true,true };
+
+			Assert::AreEqual(refVec.size(), testVec.size());
+			for (std::vector<bool>::size_type index = 0; index != refVec.size(); ++index)
+				Assert::AreEqual(bool(refVec[index]), bool(testVec[index]));
+
+			// fill constructor must not count the bits past the end
+			BIT_VECTOR_H::BitVector fillTestVec(70, true);
+			Assert::AreEqual(BIT_VECTOR_H::BitVector::size_type(70), fillTestVec.count());
+			Assert::AreEqual(BIT_VECTOR_H::BitVector::size_type(70), fillTestVec.rank(70));
+
+			BIT_VECTOR_H::BitVector emptyTestVec;
+			Assert::IsTrue(emptyTestVec.empty());
+			Assert::AreEqual(BIT_VECTOR_H::BitVector::size_type(0), emptyTestVec.count());
+			Assert::AreEqual(emptyTestVec.size(), emptyTestVec.select(0));
+			}
+
+		TEST_METHOD(RankSelectTest) {
+			std::vector<bool> refVec;
+			BIT_VECTOR_H::BitVector testVec;
+			for (int i = 0; i != 2000; ++i) {
+				const bool bit = (i * 7919) % 13 < 4;
+				refVec.push_back(bit);
+				testVec.push_back(bit);
+				}
+
+			// push_back keeps the rank directory up to date, set leaves it stale until build_rank
+			for (int pass = 0; pass != 3; ++pass) {
+				std::vector<bool>::size_type ones = 0;
+				for (std::vector<bool>::size_type index = 0; index != refVec.size(); ++index) {
+					Assert::AreEqual(ones, testVec.rank(index));
+					if (refVec[index])
+						Assert::AreEqual(index, testVec.select(ones++));
+					}
+				Assert::AreEqual(ones, testVec.count());
+				Assert::AreEqual(ones, testVec.rank(testVec.size()));
+				Assert::AreEqual(testVec.size(), testVec.select(ones));
+
+				if (pass == 0) {
+					for (int i = 0; i < 2000; i += 37) {
+						refVec[i] = !refVec[i];
+						testVec[i] = !testVec[i];
+						}
+					}
+				else
+					testVec.build_rank();
+				}
+
+			std::vector<bool>::size_type index = 0;
+			for (bool bit : testVec)
+				Assert::AreEqual(bool(refVec[index++]), bit);
+			}
+
+		};
+
+	TEST_CLASS(PackedIntVectorUnitTest) {
+
+		TEST_METHOD(ConstructorTest) {
+			std::vector<unsigned> refVec{ 1,2,3,4,5 };
+			PACKED_INT_VECTOR_H::PackedIntVector<3> testVec{ 1,2,3,4,5 };
+
+			Assert::AreEqual(refVec.size(), testVec.size());
+			for (std::vector<unsigned>::size_type index = 0; index != refVec.size(); ++index)
+				Assert::AreEqual(refVec[index], unsigned(testVec[index]));
+
+			PACKED_INT_VECTOR_H::PackedIntVector<20> fillTestVec(100, 0xabcde);
+			for (unsigned value : fillTestVec)
+				Assert::AreEqual(0xabcdeu, value);
+			// 2000 bits round up to 32 words, plus the padding word
+			Assert::AreEqual(PACKED_INT_VECTOR_H::PackedIntVector<20>::size_type(33 * 8), fillTestVec.memory_bytes());
+
+			Assert::IsTrue(PACKED_INT_VECTOR_H::PackedIntVector<7>().empty());
+			}
+
+		TEST_METHOD(AccessTest) {
+			// widths that do and do not divide the word size
+			std::vector<std::uint64_t> refVec;
+			PACKED_INT_VECTOR_H::PackedIntVector<20> testVec20;
+			PACKED_INT_VECTOR_H::PackedIntVector<64> testVec64;
+			for (std::uint64_t i = 0; i != 500; ++i) {
+				const std::uint64_t value = i * 0x9e3779b97f4a7c15ull;
+				refVec.push_back(value);
+				testVec20.push_back(std::uint32_t(value));
+				testVec64.push_back(value);
+				}
+
+			for (std::vector<std::uint64_t>::size_type index = 0; index != refVec.size(); ++index) {
+				Assert::AreEqual(std::uint32_t(refVec[index] & 0xfffff), std::uint32_t(testVec20[index]));
+				Assert::AreEqual(refVec[index], std::uint64_t(testVec64[index]));
+				}
+
+			// overwriting an element leaves its neighbours alone
+			testVec20[16] = 0xfffff;
+			testVec20[17] = testVec20[16];
+			Assert::AreEqual(std::uint32_t(refVec[15] & 0xfffff), std::uint32_t(testVec20[15]));
+			Assert::AreEqual(std::uint32_t(0xfffff), std::uint32_t(testVec20[16]));
+			Assert::AreEqual(std::uint32_t(0xfffff), std::uint32_t(testVec20[17]));
+			Assert::AreEqual(std::uint32_t(refVec[18] & 0xfffff), std::uint32_t(testVec20[18]));
+
+			// 10000 bits need 157 words plus the padding word once the growth slack is released
+			testVec20.shrink_to_fit();
+			Assert::AreEqual(PACKED_INT_VECTOR_H::PackedIntVector<20>::size_type(158 * 8), testVec20.memory_bytes());
+			Assert::AreEqual(std::uint32_t(refVec[499] & 0xfffff), std::uint32_t(testVec20[499]));
+
+			// no reallocation while pushing up to the reserved size
+			PACKED_INT_VECTOR_H::PackedIntVector<20> reservedTestVec;
+			reservedTestVec.reserve(500);
+			for (std::uint32_t value = 0; value != 500; ++value)
+				reservedTestVec.push_back(value);
+			Assert::AreEqual(PACKED_INT_VECTOR_H::PackedIntVector<20>::size_type(158 * 8), reservedTestVec.memory_bytes());
+			}
+
+		};
+
+	TEST_CLASS(DeltaVectorUnitTest) {
+
+		TEST_METHOD(AccessTest) {
+			// runs of equal values, small gaps and a gap that needs all 32 bits, with the later
+			// gaps small enough that the values never wrap past 2^32
+			std::vector<std::uint32_t> refVec;
+			DELTA_VECTOR_H::DeltaVector testVec;
+			std::uint32_t value = 0;
+			for (int i = 0; i != 1000; ++i) {
+				if (i == 700)
+					value = 0xf0000000u;
+				else if (i > 300)
+					value += i % 17;
+				refVec.push_back(value);
+				testVec.push_back(value);
+				}
+
+			Assert::AreEqual(refVec.size(), testVec.size());
+			for (std::vector<std::uint32_t>::size_type index = 0; index != refVec.size(); ++index)
+				Assert::AreEqual(refVec[index], testVec[index]);
+
+			std::vector<std::uint32_t>::size_type index = 0;
+			for (DELTA_VECTOR_H::DeltaVector::const_iterator iter = testVec.begin(); iter != testVec.end(); ++iter)
+				Assert::AreEqual(refVec[index++], *iter);
+			Assert::AreEqual(refVec.size(), index);
+
+			// releasing the growth slack keeps every value
+			const DELTA_VECTOR_H::DeltaVector::size_type grownBytes = testVec.memory_bytes();
+			testVec.shrink_to_fit();
+			Assert::IsTrue(testVec.memory_bytes() < grownBytes);
+			for (std::vector<std::uint32_t>::size_type index = 0; index != refVec.size(); ++index)
+				Assert::AreEqual(refVec[index], testVec[index]);
+
+			DELTA_VECTOR_H::DeltaVector listTestVec{ 1,1,2,3,5,8 };
+			Assert::AreEqual(std::uint32_t(8), listTestVec[5]);
+			Assert::IsTrue(DELTA_VECTOR_H::DeltaVector().empty());
+			}
+
+		};
+
+	// object that can be on an active list and an expired list at the same time
+	struct IntrusiveTimer {
+		int id;
+		SListHook activeHook;
+		SListHook expiredHook;
+
+		IntrusiveTimer(int timerId = 0) : id(timerId) {}
+		};
+
+	typedef INTRUSIVE_SLIST_H::IntrusiveSList<IntrusiveTimer, &IntrusiveTimer::activeHook> ActiveTimerList;
+	typedef INTRUSIVE_SLIST_H::IntrusiveSList<IntrusiveTimer, &IntrusiveTimer::expiredHook> ExpiredTimerList;
+
+	TEST_CLASS(IntrusiveSListUnitTest) {
+
+		TEST_METHOD(MemberFunctionsTest) {
+			IntrusiveTimer timers[5] = { 0,1,2,3,4 };
+
+			ActiveTimerList testList;
+			Assert::IsTrue(testList.empty());
+
+			testList.push_back(timers[2]);
+			testList.push_front(timers[0]);
+			testList.insert_after(timers[0], timers[1]);
+			testList.push_back(timers[4]);
+			testList.insert_after(timers[2], timers[3]);
+
+			Assert::AreEqual(ActiveTimerList::size_type(5), testList.size());
+			Assert::AreEqual(0, testList.front().id);
+			Assert::AreEqual(4, testList.back().id);
+
+			// the list links the objects themselves rather than copies
+			int id = 0;
+			for (IntrusiveTimer& timer : testList) {
+				Assert::IsTrue(&timer == &timers[id]);
+				Assert::AreEqual(id++, timer.id);
+				}
+
+			testList.erase_after(timers[3]);
+			Assert::AreEqual(3, testList.back().id);
+
+			testList.pop_front();
+			Assert::AreEqual(1, testList.front().id);
+			Assert::AreEqual(ActiveTimerList::size_type(3), testList.size());
+
+			// move constructor test
+			ActiveTimerList moveTestList(std::move(testList));
+			Assert::IsTrue(testList.empty());
+			Assert::AreEqual(ActiveTimerList::size_type(3), moveTestList.size());
+
+			moveTestList.clear();
+			Assert::IsTrue(moveTestList.empty());
+			Assert::IsTrue(moveTestList.begin() == moveTestList.end());
+			}
+
+		TEST_METHOD(MultipleHooksTest) {
+			IntrusiveTimer timers[4] = { 0,1,2,3 };
+
+			ActiveTimerList activeList;
+			ExpiredTimerList expiredList;
+			for (IntrusiveTimer& timer : timers) {
+				activeList.push_back(timer);
+				expiredList.push_front(timer);
+				}
+
+			// each list keeps its own order through its own hook
+			int id = 0;
+			for (const IntrusiveTimer& timer : activeList)
+				Assert::AreEqual(id++, timer.id);
+			for (const IntrusiveTimer& timer : expiredList)
+				Assert::AreEqual(--id, timer.id);
+
+			activeList.pop_front();
+			Assert::AreEqual(ExpiredTimerList::size_type(4), expiredList.size());
+			Assert::AreEqual(0, expiredList.back().id);
+			}
+
+		TEST_METHOD(SpliceTest) {
+			IntrusiveTimer timers[6] = { 0,1,2,3,4,5 };
+
+			ActiveTimerList testList;
+			ActiveTimerList middleList;
+			ActiveTimerList tailList;
+			testList.push_back(timers[0]);
+			testList.push_back(timers[3]);
+			middleList.push_back(timers[1]);
+			middleList.push_back(timers[2]);
+			tailList.push_back(timers[4]);
+			tailList.push_back(timers[5]);
+
+			testList.splice_after(timers[0], middleList);
+			testList.splice_back(tailList);
+
+			Assert::IsTrue(middleList.empty());
+			Assert::IsTrue(tailList.empty());
+			Assert::AreEqual(ActiveTimerList::size_type(6), testList.size());
+			Assert::AreEqual(5, testList.back().id);
+
+			int id = 0;
+			for (const IntrusiveTimer& timer : testList)
+				Assert::AreEqual(id++, timer.id);
+			}
+
+		};
+
+	TEST_CLASS(PagedVectorUnitTest) {
+
+		typedef PAGED_VECTOR_H::PagedVector<int, 4, 2> SmallPagedVector;
+
+		TEST_METHOD(ConstructorTest) {
+			// no pages are allocated up front
+			SmallPagedVector testVec(1000, -1);
+			Assert::AreEqual(SmallPagedVector::size_type(1000), testVec.size());
+			Assert::AreEqual(SmallPagedVector::size_type(0), testVec.page_count());
+
+			const SmallPagedVector& constTestVec = testVec;
+			for (SmallPagedVector::size_type index = 0; index != constTestVec.size(); ++index)
+				Assert::AreEqual(-1, constTestVec[index]);
+			Assert::AreEqual(SmallPagedVector::size_type(0), testVec.page_count());
+
+			// reading through the non-const index operator does not allocate either
+			int sum = 0;
+			for (SmallPagedVector::size_type index = 0; index != testVec.size(); ++index)
+				sum += testVec[index];
+			Assert::AreEqual(-1000, sum);
+			Assert::AreEqual(SmallPagedVector::size_type(0), testVec.page_count());
+
+			testVec[500] = 5;
+
+			// copy constructor test
+			SmallPagedVector ccTestVec(testVec);
+			Assert::AreEqual(5, int(ccTestVec[500]));
+			Assert::AreEqual(SmallPagedVector::size_type(1), ccTestVec.page_count());
+
+			// move constructor test
+			SmallPagedVector mcTestVec(std::move(ccTestVec));
+			Assert::AreEqual(5, int(mcTestVec[500]));
+			Assert::IsTrue(ccTestVec.empty());
+
+			// assignment test
+			SmallPagedVector assignTestVec;
+			assignTestVec = mcTestVec;
+			Assert::AreEqual(5, int(assignTestVec[500]));
+			assignTestVec = SmallPagedVector(10, 3);
+			Assert::AreEqual(3, int(assignTestVec[9]));
+			Assert::AreEqual(SmallPagedVector::size_type(0), assignTestVec.page_count());
+			}
+
+		TEST_METHOD(MemberFunctionsTest) {
+			SmallPagedVector testVec(1000);
+
+			// writing the default does not allocate
+			testVec.set(3, 0);
+			Assert::AreEqual(SmallPagedVector::size_type(0), testVec.page_count());
+
+			testVec.set(3, 7);
+			testVec[900] = 9;
+			testVec.push_back(11);
+			Assert::AreEqual(SmallPagedVector::size_type(1001), testVec.size());
+			Assert::AreEqual(SmallPagedVector::size_type(3), testVec.page_count());
+
+			// the populated iterator only visits allocated pages
+			int sum = 0;
+			SmallPagedVector::size_type visited = 0;
+			for (SmallPagedVector::const_iterator iter = testVec.populated_begin(); iter != testVec.populated_end(); ++iter) {
+				sum += *iter;
+				++visited;
+				}
+			Assert::AreEqual(7 + 9 + 11, sum);
+			Assert::AreEqual(SmallPagedVector::size_type(16 + 16 + 9), visited);
+
+			// the full iterator visits every element
+			visited = 0;
+			for (const int& elem : testVec)
+				visited += elem == 0;
+			Assert::AreEqual(SmallPagedVector::size_type(1001 - 3), visited);
+
+			// pages that return to the default can be released
+			testVec.set(3, 0);
+			testVec[900] = 0;
+			Assert::AreEqual(SmallPagedVector::size_type(2), testVec.release_default_pages());
+			Assert::AreEqual(SmallPagedVector::size_type(1), testVec.page_count());
+			Assert::AreEqual(11, int(testVec[1000]));
+			Assert::AreEqual(0, int(testVec[900]));
+			}
+
+		};
+
+	TEST_CLASS(RadixSortUnitTest) {
+
+		TEST_METHOD(IntegerSortTest) {
+			std::vector<std::uint64_t> refVec;
+			VECTOR_H::Vector<std::uint64_t> testVec;
+			std::uint64_t value = 88172645463325252ull;
+			for (int i = 0; i != 300000; ++i) {
+				// xorshift, keeping the top bytes equal for some elements so that their passes are skipped
+				value ^= value << 13;
+				value ^= value >> 7;
+				value ^= value << 17;
+				const std::uint64_t elem = i % 3 ? value : value & 0xffff;
+				refVec.push_back(elem);
+				testVec.push_back(elem);
+				}
+			std::sort(refVec.begin(), refVec.end());
+
+			VECTOR_H::Vector<std::uint64_t> msdTestVec = testVec;
+			VECTOR_H::Vector<std::uint64_t> threadedTestVec = testVec;
+
+			RADIX_SORT_H::radix_sort(testVec);
+			RADIX_SORT_H::RadixSorter<std::uint64_t>().sort_msd(msdTestVec);
+			RADIX_SORT_H::RadixSorter<std::uint64_t>(4).sort(threadedTestVec);
+
+			for (std::vector<std::uint64_t>::size_type index = 0; index != refVec.size(); ++index) {
+				Assert::AreEqual(refVec[index], testVec[index]);
+				Assert::AreEqual(refVec[index], msdTestVec[index]);
+				Assert::AreEqual(refVec[index], threadedTestVec[index]);
+				}
+
+			// signed keys
+			VECTOR_H::Vector<int> signedTestVec{ 5,-3,0,std::numeric_limits<int>::min(),-1,std::numeric_limits<int>::max(),2 };
+			std::vector<int> signedRefVec(signedTestVec.begin(), signedTestVec.end());
+			std::sort(signedRefVec.begin(), signedRefVec.end());
+			RADIX_SORT_H::radix_sort(signedTestVec);
+			for (std::vector<int>::size_type index = 0; index != signedRefVec.size(); ++index)
+				Assert::AreEqual(signedRefVec[index], signedTestVec[index]);
+			}
+
+		TEST_METHOD(FloatSortTest) {
+			const float inf = std::numeric_limits<float>::infinity();
+			VECTOR_H::Vector<float> testVec{ 1.5f,-0.25f,inf,0.0f,-inf,-7.0f,3.0f,-0.5f,1e-30f };
+			std::vector<float> refVec(testVec.begin(), testVec.end());
+			std::sort(refVec.begin(), refVec.end());
+
+			VECTOR_H::Vector<float> msdTestVec = testVec;
+			RADIX_SORT_H::radix_sort(testVec);
+			RADIX_SORT_H::RadixSorter<float>().sort_msd(msdTestVec);
+
+			for (std::vector<float>::size_type index = 0; index != refVec.size(); ++index) {
+				Assert::AreEqual(refVec[index], testVec[index]);
+				Assert::AreEqual(refVec[index], msdTestVec[index]);
+				}
+
+			VECTOR_H::Vector<double> doubleTestVec{ 2.0,-1.0,0.5,-1e300 };
+			RADIX_SORT_H::radix_sort(doubleTestVec);
+			Assert::AreEqual(-1e300, doubleTestVec[0]);
+			Assert::AreEqual(2.0, doubleTestVec[3]);
+			}
+
+		TEST_METHOD(RecordSortTest) {
+			typedef std::pair<std::uint32_t, int> Record;
+
+			// the sort is stable, so records with equal keys keep their input order
+			VECTOR_H::Vector<Record> testVec;
+			for (int i = 0; i != 3000; ++i)
+				testVec.push_back(Record(std::uint32_t((i * 7919) % 101), i));
+			std::vector<Record> refVec(testVec.begin(), testVec.end());
+			std::stable_sort(refVec.begin(), refVec.end(), [](const Record& lhs, const Record& rhs) { return lhs.first < rhs.first; });
+
+			// the same sorter is reused for a smaller input
+			RADIX_SORT_H::RadixSorter<Record> sorter;
+			VECTOR_H::Vector<Record> smallTestVec{ Record(3, 0),Record(1, 1),Record(2, 2) };
+			sorter.sort(testVec, [](const Record& record) { return record.first; });
+			sorter.sort(smallTestVec, [](const Record& record) { return record.first; });
+
+			for (std::vector<Record>::size_type index = 0; index != refVec.size(); ++index) {
+				Assert::AreEqual(refVec[index].first, testVec[index].first);
+				Assert::AreEqual(refVec[index].second, testVec[index].second);
+				}
+			Assert::AreEqual(1, smallTestVec[0].second);
+			Assert::AreEqual(0, smallTestVec[2].second);
+			}
+
+		};
+
+	TEST_CLASS(PriorityQueueUnitTest) {
+
+		TEST_METHOD(ConstructorTest) {
+			// heapify an existing vector
+			VECTOR_H::Vector<int> elems{ 5,1,9,3,7,2,8,6,4,0 };
+			PRIORITY_QUEUE_H::PriorityQueue<int> testQueue(elems);
+			Assert::AreEqual(PRIORITY_QUEUE_H::PriorityQueue<int>::size_type(10), testQueue.size());
+			for (int expected = 9; expected >= 0; --expected) {
+				Assert::AreEqual(expected, testQueue.top());
+				testQueue.pop();
+				}
+			Assert::IsTrue(testQueue.empty());
+
+			// a min-heap of arity 2 from an initializer list
+			PRIORITY_QUEUE_H::PriorityQueue<int, std::greater<int>, 2> minQueue{ 4,2,6 };
+			Assert::AreEqual(2, minQueue.top());
+			}
+
+		TEST_METHOD(MemberFunctionsTest) {
+			std::priority_queue<int, std::vector<int>, std::greater<int>> refQueue;
+			PRIORITY_QUEUE_H::PriorityQueue<int, std::greater<int>> testQueue;
+			PRIORITY_QUEUE_H::PriorityQueue<int, std::greater<int>, 8> wideTestQueue;
+
+			unsigned value = 12345;
+			for (int i = 0; i != 20000; ++i) {
+				value = value * 1103515245 + 12345;
+				const int elem = int((value >> 8) % 1000);
+				// pop roughly one element for every two pushes
+				if (i % 3 == 2 && !refQueue.empty()) {
+					Assert::AreEqual(refQueue.top(), testQueue.top());
+					Assert::AreEqual(refQueue.top(), wideTestQueue.top());
+					refQueue.pop();
+					testQueue.pop();
+					wideTestQueue.pop();
+					}
+				else {
+					refQueue.push(elem);
+					testQueue.push(elem);
+					wideTestQueue.push(elem);
+					}
+				}
+
+			// bulk pushes, both small enough to sift up and large enough to rebuild the heap
+			int few[] = { -1,2000,5 };
+			VECTOR_H::Vector<int> many(5000, 0);
+			for (VECTOR_H::Vector<int>::size_type index = 0; index != many.size(); ++index)
+				many[index] = int((index * 7919) % 3001) - 1000;
+			testQueue.push(few, few + 3);
+			testQueue.push(many.begin(), many.end());
+			for (int elem : few)
+				refQueue.push(elem);
+			for (int elem : many)
+				refQueue.push(elem);
+
+			Assert::AreEqual(refQueue.size(), testQueue.size());
+			while (!refQueue.empty()) {
+				Assert::AreEqual(refQueue.top(), testQueue.top());
+				refQueue.pop();
+				testQueue.pop();
+				}
+			Assert::IsTrue(testQueue.empty());
+			}
+
+		TEST_METHOD(HandleTest) {
+			typedef PRIORITY_QUEUE_H::PriorityQueue<int, std::greater<int>, 4, true> TimerQueue;
+
+			// element i of the vector gets handle i
+			TimerQueue testQueue(VECTOR_H::Vector<int>{ 50,10,40,30,20 });
+			Assert::AreEqual(10, testQueue.top());
+			Assert::AreEqual(40, testQueue.get(2));
+
+			testQueue.decrease_key(2, 5);
+			Assert::AreEqual(5, testQueue.top());
+			// update can move an element either way
+			testQueue.update(2, 45);
+			Assert::AreEqual(10, testQueue.top());
+			Assert::AreEqual(45, testQueue.get(2));
+
+			testQueue.erase(1);
+			Assert::AreEqual(20, testQueue.top());
+			Assert::AreEqual(TimerQueue::size_type(4), testQueue.size());
+
+			// the erased handle is handed out again
+			Assert::AreEqual(TimerQueue::handle_type(1), testQueue.push(35));
+			TimerQueue::handle_type handles[3];
+			int deadlines[] = { 25,15,60 };
+			testQueue.push(deadlines, deadlines + 3, handles);
+			Assert::AreEqual(TimerQueue::handle_type(5), handles[0]);
+			Assert::AreEqual(TimerQueue::handle_type(7), handles[2]);
+
+			// handles stay valid while other elements move around
+			testQueue.erase(handles[1]);
+			Assert::AreEqual(35, testQueue.get(1));
+			Assert::AreEqual(60, testQueue.get(7));
+			Assert::AreEqual(50, testQueue.get(0));
+
+			int expected[] = { 20,25,30,35,45,50,60 };
+			for (int elem : expected) {
+				Assert::AreEqual(elem, testQueue.top());
+				testQueue.pop();
+				}
+			Assert::IsTrue(testQueue.empty());
+			}
+
+		};
+
+	TEST_CLASS(RcuVectorUnitTest) {
+
+		TEST_METHOD(SnapshotTest) {
+			RCU_VECTOR_H::RcuVector<int> testRcu(VECTOR_H::Vector<int>{ 1,2,3 });
+			RCU_VECTOR_H::RcuVector<int>::reader testReader = testRcu.register_reader();
+
+			RCU_VECTOR_H::RcuVector<int>::snapshot oldSnap = testReader.pin();
+			testRcu.publish(VECTOR_H::Vector<int>{ 4,5 });
+
+			// the pinned version is unchanged and kept alive
+			Assert::AreEqual(RCU_VECTOR_H::RcuVector<int>::size_type(3), oldSnap.size());
+			Assert::AreEqual(3, oldSnap[2]);
+			Assert::AreEqual(RCU_VECTOR_H::RcuVector<int>::size_type(1), testRcu.retired());
+
+			{
+				// a nested pin sees the new version and does not release the old one
+				RCU_VECTOR_H::RcuVector<int>::snapshot newSnap = testReader.pin();
+				Assert::AreEqual(RCU_VECTOR_H::RcuVector<int>::size_type(2), newSnap.size());
+				Assert::AreEqual(4, *newSnap.begin());
+				}
+			testRcu.reclaim();
+			Assert::AreEqual(RCU_VECTOR_H::RcuVector<int>::size_type(1), testRcu.retired());
+			}
+
+		TEST_METHOD(MemberFunctionsTest) {
+			RCU_VECTOR_H::RcuVector<int> testRcu;
+			RCU_VECTOR_H::RcuVector<int>::reader testReader = testRcu.register_reader();
+			Assert::IsTrue(testReader.pin()->empty());
+
+			testRcu.update([](VECTOR_H::Vector<int>& vec) { vec.push_back(7); });
+			testRcu.update([](VECTOR_H::Vector<int>& vec) { vec.push_back(8); });
+			{
+				RCU_VECTOR_H::RcuVector<int>::snapshot snap = testReader.pin();
+				Assert::AreEqual(RCU_VECTOR_H::RcuVector<int>::size_type(2), snap.size());
+				Assert::AreEqual(8, snap[1]);
+
+				const VECTOR_H::Vector<int> replacement{ 9 };
+				testRcu.publish(replacement);
+				Assert::AreEqual(RCU_VECTOR_H::RcuVector<int>::size_type(1), testRcu.retired());
+				}
+			// versions no reader is pinned to are deleted straight away
+			testRcu.reclaim();
+			Assert::AreEqual(RCU_VECTOR_H::RcuVector<int>::size_type(0), testRcu.retired());
+			Assert::AreEqual(9, testReader.pin()[0]);
+
+			// slots are handed back when a reader is destroyed
+			RCU_VECTOR_H::RcuVector<int, 2> smallRcu;
+			RCU_VECTOR_H::RcuVector<int, 2>::reader first = smallRcu.register_reader();
+			{
+				RCU_VECTOR_H::RcuVector<int, 2>::reader second = smallRcu.register_reader();
+				Assert::ExpectException<std::length_error>([&]() { smallRcu.register_reader(); });
+				}
+			RCU_VECTOR_H::RcuVector<int, 2>::reader third = smallRcu.register_reader();
+			}
+
+		TEST_METHOD(ConcurrentTest) {
+			// every version holds one value repeated, so a reader that sees a mix has read a torn or freed version
+			RCU_VECTOR_H::RcuVector<int> testRcu(VECTOR_H::Vector<int>(64, 0));
+			std::atomic<bool> done(false);
+			std::atomic<int> tornReads(0);
+
+			std::vector<std::thread> readers;
+			for (int thread = 0; thread != 4; ++thread) {
+				readers.emplace_back([&]() {
+					RCU_VECTOR_H::RcuVector<int>::reader testReader = testRcu.register_reader();
+					while (!done.load()) {
+						RCU_VECTOR_H::RcuVector<int>::snapshot snap = testReader.pin();
+						for (int elem : snap)
+							if (elem != snap[0])
+								++tornReads;
+						}
+					});
+				}
+
+			for (int version = 1; version != 2000; ++version)
+				testRcu.publish(VECTOR_H::Vector<int>(64, version));
+			done.store(true);
+			for (std::thread& reader : readers)
+				reader.join();
+
+			Assert::AreEqual(0, tornReads.load());
+			testRcu.reclaim();
+			Assert::AreEqual(RCU_VECTOR_H::RcuVector<int>::size_type(0), testRcu.retired());
+			}
+
 		};
 }
\ No newline at end of file